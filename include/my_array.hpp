@@ -36,6 +36,24 @@ public:
         }
     }
 
+    // Evaluates a lazy element-wise expression (see my_expr.hpp) in one pass.
+    template<typename Expr> requires requires { typename Expr::my_expression_tag; }
+    my_array(const Expr &expr) {
+        *this = expr;
+    }
+
+    template<typename Expr> requires requires { typename Expr::my_expression_tag; }
+    my_array& operator=(const Expr &expr) {
+        const Expr local = expr;
+        if (local.size() != N) {
+            throw std::invalid_argument("The expression size does not match the array!");
+        }
+        for (size_t i = 0; i < N; ++i) {
+            data[i] = static_cast<T>(local[i]);
+        }
+        return *this;
+    }
+
     T& operator[](size_t value) noexcept {
         return data[value];
     }
@@ -0,0 +1,333 @@
+#ifndef MY_VECTOR_MY_BITVECTOR_HPP
+#define MY_VECTOR_MY_BITVECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include "my_vector.hpp"
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
+// Bit vector packing 64 flags per word. count/rank/select use std::popcount,
+// which compiles to the popcnt instruction when the target supports it.
+// rank and select use a small index with the number of ones before every
+// 512-bit block. Any modification invalidates it; call build_index() after
+// the last change and before querying. rank and select only read, so a
+// built bit vector can be queried from several threads at once.
+class my_bitvector {
+public:
+    static constexpr size_t word_bits = 64;
+    static constexpr size_t block_words = 8;
+
+    my_bitvector() : size_m(0), index_valid_m(false) {};
+
+    explicit my_bitvector(size_t n, bool value = false) : size_m(0), index_valid_m(false) {
+        resize(n, value);
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return size_m == 0;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return size_m;
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return words_m.capacity() * word_bits;
+    }
+
+    void reserve(size_t value) {
+        words_m.reserve(words_for(value));
+    }
+
+    bool operator[](size_t index) const {
+        return (words_m[index / word_bits] >> (index % word_bits)) & 1;
+    }
+
+    [[nodiscard]] bool test(size_t index) const {
+        if (index >= size_m) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return (*this)[index];
+    }
+
+    void set(size_t index, bool value = true) {
+        if (index >= size_m) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        uint64_t mask = uint64_t(1) << (index % word_bits);
+        if (value) {
+            words_m[index / word_bits] |= mask;
+        } else {
+            words_m[index / word_bits] &= ~mask;
+        }
+        index_valid_m = false;
+    }
+
+    void reset(size_t index) {
+        set(index, false);
+    }
+
+    void flip(size_t index) {
+        set(index, !test(index));
+    }
+
+    // Sets or clears every bit in [first, last), a whole word at a time.
+    void set_range(size_t first, size_t last, bool value = true) {
+        if (first > last || last > size_m) {
+            throw std::out_of_range("The range is out of range!");
+        }
+        if (first == last) {
+            return;
+        }
+        size_t first_word = first / word_bits;
+        size_t last_word = (last - 1) / word_bits;
+        for (size_t w = first_word; w <= last_word; ++w) {
+            uint64_t mask = ~uint64_t(0);
+            if (w == first_word) {
+                mask &= ~uint64_t(0) << (first % word_bits);
+            }
+            if (w == last_word) {
+                mask &= low_mask(last - w * word_bits);
+            }
+            if (value) {
+                words_m[w] |= mask;
+            } else {
+                words_m[w] &= ~mask;
+            }
+        }
+        index_valid_m = false;
+    }
+
+    void clear_range(size_t first, size_t last) {
+        set_range(first, last, false);
+    }
+
+    void push_back(bool value) {
+        if (size_m % word_bits == 0) {
+            words_m.push_back(0);
+        }
+        if (value) {
+            words_m[size_m / word_bits] |= uint64_t(1) << (size_m % word_bits);
+        }
+        ++size_m;
+        index_valid_m = false;
+    }
+
+    void pop_back() {
+        --size_m;
+        words_m[size_m / word_bits] &= ~(uint64_t(1) << (size_m % word_bits));
+        if (size_m % word_bits == 0) {
+            words_m.pop_back();
+        }
+        index_valid_m = false;
+    }
+
+    void resize(size_t value, bool elem = false) {
+        if (value == size_m) return;
+        size_t old_size = size_m;
+        words_m.resize(words_for(value), 0);
+        size_m = value;
+        if (value > old_size) {
+            if (elem) {
+                set_range(old_size, value);
+            }
+        } else {
+            clear_tail();
+        }
+        index_valid_m = false;
+    }
+
+    void clear() {
+        words_m.clear();
+        size_m = 0;
+        index_valid_m = false;
+    }
+
+    void fill(bool value) {
+        for (size_t w = 0; w < words_m.size(); ++w) {
+            words_m[w] = value ? ~uint64_t(0) : 0;
+        }
+        clear_tail();
+        index_valid_m = false;
+    }
+
+    my_bitvector& operator&=(const my_bitvector &other) {
+        check_same_size(other);
+        for (size_t w = 0; w < words_m.size(); ++w) {
+            words_m[w] &= other.words_m[w];
+        }
+        index_valid_m = false;
+        return *this;
+    }
+
+    my_bitvector& operator|=(const my_bitvector &other) {
+        check_same_size(other);
+        for (size_t w = 0; w < words_m.size(); ++w) {
+            words_m[w] |= other.words_m[w];
+        }
+        index_valid_m = false;
+        return *this;
+    }
+
+    my_bitvector& operator^=(const my_bitvector &other) {
+        check_same_size(other);
+        for (size_t w = 0; w < words_m.size(); ++w) {
+            words_m[w] ^= other.words_m[w];
+        }
+        index_valid_m = false;
+        return *this;
+    }
+
+    friend my_bitvector operator&(my_bitvector lhs, const my_bitvector &rhs) {
+        lhs &= rhs;
+        return lhs;
+    }
+
+    friend my_bitvector operator|(my_bitvector lhs, const my_bitvector &rhs) {
+        lhs |= rhs;
+        return lhs;
+    }
+
+    friend my_bitvector operator^(my_bitvector lhs, const my_bitvector &rhs) {
+        lhs ^= rhs;
+        return lhs;
+    }
+
+    friend bool operator==(const my_bitvector &lhs, const my_bitvector &rhs) {
+        return lhs.size_m == rhs.size_m && lhs.words_m == rhs.words_m;
+    }
+
+    friend bool operator!=(const my_bitvector &lhs, const my_bitvector &rhs) {
+        return !(lhs == rhs);
+    }
+
+    // number of set bits
+    [[nodiscard]] size_t count() const {
+        size_t result = 0;
+        for (size_t w = 0; w < words_m.size(); ++w) {
+            result += std::popcount(words_m[w]);
+        }
+        return result;
+    }
+
+    // Counts the ones before every 512-bit block for rank and select; does
+    // nothing if the index is already up to date.
+    void build_index() {
+        if (index_valid_m) {
+            return;
+        }
+        size_t blocks = (words_m.size() + block_words - 1) / block_words;
+        block_ranks_m.resize(blocks + 1, 0);
+        uint64_t total = 0;
+        for (size_t b = 0; b < blocks; ++b) {
+            block_ranks_m[b] = total;
+            size_t end_word = std::min(words_m.size(), (b + 1) * block_words);
+            for (size_t w = b * block_words; w < end_word; ++w) {
+                total += std::popcount(words_m[w]);
+            }
+        }
+        block_ranks_m[blocks] = total;
+        index_valid_m = true;
+    }
+
+    [[nodiscard]] bool is_index_built() const {
+        return index_valid_m;
+    }
+
+    // number of set bits in [0, pos); needs build_index()
+    [[nodiscard]] size_t rank(size_t pos) const {
+        if (pos > size_m) {
+            throw std::out_of_range("The position is out of range!");
+        }
+        check_index();
+        size_t word = pos / word_bits;
+        size_t block = word / block_words;
+        size_t result = block_ranks_m[block];
+        for (size_t w = block * block_words; w < word; ++w) {
+            result += std::popcount(words_m[w]);
+        }
+        if (pos % word_bits != 0) {
+            result += std::popcount(words_m[word] & low_mask(pos % word_bits));
+        }
+        return result;
+    }
+
+    // position of the k-th (zero based) set bit; needs build_index()
+    [[nodiscard]] size_t select(size_t k) const {
+        check_index();
+        size_t blocks = block_ranks_m.size() - 1;
+        if (k >= block_ranks_m[blocks]) {
+            throw std::out_of_range("There are not that many set bits!");
+        }
+        const uint64_t* ranks = block_ranks_m.cbegin();
+        size_t block = std::upper_bound(ranks, ranks + blocks + 1, k) - ranks - 1;
+        size_t remaining = k - ranks[block];
+        size_t w = block * block_words;
+        while (true) {
+            size_t ones = std::popcount(words_m[w]);
+            if (remaining < ones) {
+                break;
+            }
+            remaining -= ones;
+            ++w;
+        }
+        return w * word_bits + select_in_word(words_m[w], remaining);
+    }
+
+    const my_vector<uint64_t>& words() const {
+        return words_m;
+    }
+
+private:
+    static size_t words_for(size_t bits) {
+        return (bits + word_bits - 1) / word_bits;
+    }
+
+    static uint64_t low_mask(size_t bits) {
+        return bits >= word_bits ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+    }
+
+    static size_t select_in_word(uint64_t word, size_t k) {
+#ifdef __BMI2__
+        return std::countr_zero(_pdep_u64(uint64_t(1) << k, word));
+#else
+        for (size_t i = 0; i < k; ++i) {
+            word &= word - 1;
+        }
+        return std::countr_zero(word);
+#endif
+    }
+
+    // bits past size() in the last word are kept zero, so whole-word
+    // operations (count, comparisons) need no extra masking
+    void clear_tail() {
+        if (size_m % word_bits != 0) {
+            words_m[size_m / word_bits] &= low_mask(size_m % word_bits);
+        }
+    }
+
+    void check_same_size(const my_bitvector &other) const {
+        if (size_m != other.size_m) {
+            throw std::invalid_argument("Bit vectors have different sizes!");
+        }
+    }
+
+    void check_index() const {
+        if (!index_valid_m) {
+            throw std::logic_error("The rank index is out of date, call build_index()!");
+        }
+    }
+
+    my_vector<uint64_t> words_m;
+    size_t size_m;
+    my_vector<uint64_t> block_ranks_m;
+    bool index_valid_m;
+};
+
+#endif //MY_VECTOR_MY_BITVECTOR_HPP
@@ -0,0 +1,384 @@
+#ifndef MY_VECTOR_MY_COMPACT_VECTOR_HPP
+#define MY_VECTOR_MY_COMPACT_VECTOR_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "my_span.hpp"
+
+// Same interface as my_vector, but the object itself is a single pointer:
+// size and capacity are stored in a header right before the elements, and
+// an empty vector that never allocated is just a null pointer. Meant for
+// containers holding many mostly-empty vectors (adjacency lists and such).
+template<typename T>
+class my_compact_vector {
+public:
+    my_compact_vector() noexcept : header_m(nullptr) {};
+
+    my_compact_vector(const int &n, const T &d) : header_m(nullptr) {
+        if (n <= 0) {
+            return;
+        }
+        header_m = allocate(n);
+        std::uninitialized_fill_n(elements(), n, d);
+        header_m->size = n;
+    }
+
+    template<typename Iter>
+    my_compact_vector(Iter start_interval, Iter end_interval) : header_m(nullptr) {
+        size_t count = std::distance(start_interval, end_interval);
+        if (count == 0) {
+            return;
+        }
+        header_m = allocate(count);
+        std::uninitialized_copy(start_interval, end_interval, elements());
+        header_m->size = count;
+    }
+
+    explicit my_compact_vector(my_span<const T> items) : my_compact_vector(items.begin(), items.end()) {}
+
+    my_compact_vector(const std::initializer_list<T> &arg) : my_compact_vector(arg.begin(), arg.end()) {}
+
+    // copy constructor
+    my_compact_vector(const my_compact_vector &other) : my_compact_vector(other.cbegin(), other.cend()) {}
+
+    // move constructor
+    my_compact_vector(my_compact_vector &&other) noexcept : header_m(other.header_m) {
+        other.header_m = nullptr;
+    }
+
+    // copy assignment
+    my_compact_vector& operator=(const my_compact_vector &other) {
+        if (&other != this) {
+            my_compact_vector copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    // move assignment
+    my_compact_vector& operator=(my_compact_vector &&other) noexcept {
+        if (&other != this) {
+            release();
+            header_m = other.header_m;
+            other.header_m = nullptr;
+        }
+        return *this;
+    }
+
+    ~my_compact_vector() {
+        release();
+    }
+
+    T& operator[](const size_t &value) const {
+        return elements()[value];
+    }
+
+    T& at(const size_t &index) const {
+        if (index >= size()) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return elements()[index];
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return size() == 0;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return header_m == nullptr ? 0 : header_m->size;
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return header_m == nullptr ? 0 : header_m->capacity;
+    }
+
+    void reserve(size_t value) {
+        if (value <= capacity()) {
+            return;
+        }
+        reallocate(value);
+    }
+
+    void shrink_to_fit() {
+        if (capacity() == size()) {
+            return;
+        }
+        if (size() == 0) {
+            release();
+            return;
+        }
+        reallocate(size());
+    }
+
+    void swap(my_compact_vector &other) noexcept {
+        std::swap(header_m, other.header_m);
+    }
+
+    void clear() {
+        if (header_m == nullptr) {
+            return;
+        }
+        std::destroy_n(elements(), header_m->size);
+        header_m->size = 0;
+    }
+
+    void resize(size_t value, T elem=T()) {
+        size_t old_size = size();
+        if (value == old_size) return;
+        if (value < old_size) {
+            std::destroy(elements() + value, elements() + old_size);
+        } else {
+            if (value > capacity()) {
+                reallocate(std::max(value, capacity() * 2));
+            }
+            std::uninitialized_fill(elements() + old_size, elements() + value, elem);
+        }
+        header_m->size = value;
+    }
+
+    T* insert(T* pos, const T &value) {
+        size_t index = pos - begin();
+        if (size() == capacity()) {
+            T copy(value);
+            grow(size() + 1);
+            return insert_slot(index, std::move(copy));
+        }
+        return insert_slot(index, value);
+    }
+
+    T* insert(T* pos, const T* begin_take, const T* end_take) {
+        size_t index = pos - begin();
+        size_t count = end_take - begin_take;
+        if (count == 0) {
+            return begin() + index;
+        }
+        size_t old_size = size();
+        if (old_size + count > capacity()) {
+            my_compact_vector merged;
+            merged.header_m = allocate(std::max(old_size + count, capacity() * 2));
+            T* out = merged.elements();
+            out = std::uninitialized_copy(cbegin(), cbegin() + index, out);
+            merged.header_m->size = index;
+            out = std::uninitialized_copy(begin_take, end_take, out);
+            merged.header_m->size += count;
+            std::uninitialized_copy(cbegin() + index, cend(), out);
+            merged.header_m->size = old_size + count;
+            swap(merged);
+            return begin() + index;
+        }
+        T* data = elements();
+        size_t tail = old_size - index;
+        if (tail > count) {
+            std::uninitialized_move(data + old_size - count, data + old_size, data + old_size);
+            std::move_backward(data + index, data + old_size - count, data + old_size);
+            std::copy(begin_take, end_take, data + index);
+        } else {
+            std::uninitialized_copy(begin_take + tail, end_take, data + old_size);
+            std::uninitialized_move(data + index, data + old_size, data + index + count);
+            std::copy(begin_take, begin_take + tail, data + index);
+        }
+        header_m->size += count;
+        return begin() + index;
+    }
+
+    T* insert(T* pos, my_span<const T> items) {
+        return insert(pos, items.begin(), items.end());
+    }
+
+    T* erase(const size_t pos) {
+        T* data = elements();
+        std::move(data + pos + 1, data + header_m->size, data + pos);
+        std::destroy_at(data + header_m->size - 1);
+        header_m->size--;
+        return begin() + pos;
+    }
+
+    T* erase(T* begin_, T* end) {
+        size_t first_ind = begin_ - begin();
+        if (begin_ == end) {
+            return begin() + first_ind;
+        }
+        T* new_end = std::move(end, this->end(), begin_);
+        std::destroy(new_end, this->end());
+        header_m->size = new_end - elements();
+        return begin() + first_ind;
+    }
+
+    void pop_back() {
+        std::destroy_at(elements() + header_m->size - 1);
+        header_m->size--;
+    }
+
+    void push_back(const T &value) {
+        if (size() == capacity()) {
+            T copy(value);
+            grow(size() + 1);
+            new (elements() + header_m->size) T(std::move(copy));
+        } else {
+            new (elements() + header_m->size) T(value);
+        }
+        ++header_m->size;
+    }
+
+    void emplace_back(T &&value) {
+        if (size() == capacity()) {
+            grow(size() + 1);
+        }
+        new (elements() + header_m->size) T(std::move(value));
+        ++header_m->size;
+    }
+
+    friend bool operator==(const my_compact_vector<T>& lhs, const my_compact_vector<T>& rhs) {
+        return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+    }
+
+    friend bool operator!=(const my_compact_vector<T>& lhs, const my_compact_vector<T>& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const my_compact_vector<T>& lhs, const my_compact_vector<T>& rhs) {
+        return std::lexicographical_compare(lhs.cbegin(), lhs.cend(),
+                                            rhs.cbegin(), rhs.cend());
+    }
+
+    friend bool operator<=(const my_compact_vector<T>& lhs, const my_compact_vector<T>& rhs) {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>(const my_compact_vector<T>& lhs, const my_compact_vector<T>& rhs) {
+        return rhs < lhs;
+    }
+
+    friend bool operator>=(const my_compact_vector<T>& lhs, const my_compact_vector<T>& rhs) {
+        return !(lhs < rhs);
+    }
+
+    friend void swap(my_compact_vector<T>& lhs, my_compact_vector<T>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
+    T* begin() {
+        return elements();
+    }
+
+    const T* cbegin() const {
+        return elements();
+    }
+
+    T* end() {
+        return elements() + size();
+    }
+
+    const T* cend() const {
+        return elements() + size();
+    }
+
+    T front() const {
+        return elements()[0];
+    }
+
+    T back() const {
+        return elements()[size() - 1];
+    }
+
+    std::reverse_iterator<T*> rbegin() {
+        return std::reverse_iterator<T*>(end());
+    }
+
+    std::reverse_iterator<const T*> rcbegin() const {
+        return std::reverse_iterator<const T*>(cend());
+    }
+
+    std::reverse_iterator<T*> rend() {
+        return std::reverse_iterator<T*>(begin());
+    }
+
+    std::reverse_iterator<const T*> rcend() const {
+        return std::reverse_iterator<const T*>(cbegin());
+    }
+
+private:
+    struct header {
+        size_t size;
+        size_t capacity;
+    };
+
+    static constexpr size_t alignment = std::max(alignof(header), alignof(T));
+    // elements start at the first T-aligned offset after the header
+    static constexpr size_t elements_offset = (sizeof(header) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    static header* allocate(size_t capacity) {
+        void* raw = ::operator new(elements_offset + capacity * sizeof(T), std::align_val_t(alignment));
+        auto* result = static_cast<header*>(raw);
+        result->size = 0;
+        result->capacity = capacity;
+        return result;
+    }
+
+    static void deallocate(header* block) noexcept {
+        ::operator delete(block, std::align_val_t(alignment));
+    }
+
+    T* elements() const {
+        if (header_m == nullptr) {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(header_m) + elements_offset);
+    }
+
+    void release() noexcept {
+        if (header_m == nullptr) {
+            return;
+        }
+        std::destroy_n(elements(), header_m->size);
+        deallocate(header_m);
+        header_m = nullptr;
+    }
+
+    void reallocate(size_t new_capacity) {
+        header* block = allocate(new_capacity);
+        T* target = reinterpret_cast<T*>(reinterpret_cast<char*>(block) + elements_offset);
+        size_t old_size = size();
+        try {
+            if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move(elements(), elements() + old_size, target);
+            } else {
+                std::uninitialized_copy(elements(), elements() + old_size, target);
+            }
+        } catch (...) {
+            deallocate(block);
+            throw;
+        }
+        block->size = old_size;
+        release();
+        header_m = block;
+    }
+
+    void grow(size_t min_capacity) {
+        reallocate(std::max(min_capacity, capacity() * 2));
+    }
+
+    T* insert_slot(size_t index, T value) {
+        T* data = elements();
+        size_t old_size = header_m->size;
+        if (index == old_size) {
+            new (data + old_size) T(std::move(value));
+        } else {
+            new (data + old_size) T(std::move(data[old_size - 1]));
+            std::move_backward(data + index, data + old_size - 1, data + old_size);
+            data[index] = std::move(value);
+        }
+        ++header_m->size;
+        return data + index;
+    }
+
+    header *header_m;
+};
+
+#endif //MY_VECTOR_MY_COMPACT_VECTOR_HPP
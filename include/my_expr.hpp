@@ -0,0 +1,218 @@
+#ifndef MY_VECTOR_MY_EXPR_HPP
+#define MY_VECTOR_MY_EXPR_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include "my_array.hpp"
+#include "my_vector.hpp"
+
+// Lazy element-wise arithmetic for numeric my_vector and my_array. The
+// operators +, -, *, / and unary - only build a small tree of nodes that
+// refer to their operands; assigning the tree to a my_vector or my_array
+// (or constructing one from it) evaluates every element in a single loop,
+// with no temporary vectors:
+//
+//     my_vector<float> c = a * 2.0f + b;
+//     c -= a / b;
+//
+// Operands are held by pointer, so a tree kept in an auto variable must not
+// outlive the vectors it was built from. Mismatched sizes throw
+// std::invalid_argument when the tree is built.
+
+template<typename T>
+struct my_expr_container_traits {
+    static constexpr bool value = false;
+};
+
+template<typename T>
+struct my_expr_container_traits<my_vector<T>> {
+    static constexpr bool value = std::is_arithmetic_v<T>;
+    using value_type = T;
+};
+
+template<typename T, size_t N>
+struct my_expr_container_traits<my_array<T, N>> {
+    static constexpr bool value = std::is_arithmetic_v<T>;
+    using value_type = T;
+};
+
+template<typename E>
+concept my_expression = requires { typename E::my_expression_tag; };
+
+template<typename A>
+concept my_expr_container = my_expr_container_traits<A>::value;
+
+template<typename A>
+concept my_expr_operand = my_expression<A> || my_expr_container<A> || std::is_arithmetic_v<A>;
+
+// A contiguous run of elements of a my_vector or my_array.
+template<typename T>
+class my_expr_leaf {
+public:
+    using my_expression_tag = void;
+    static constexpr bool scalar = false;
+
+    my_expr_leaf(const T* data, size_t size) : data_m(data), size_m(size) {}
+
+    [[nodiscard]] size_t size() const {
+        return size_m;
+    }
+
+    const T& operator[](size_t index) const {
+        return data_m[index];
+    }
+
+private:
+    const T* data_m;
+    size_t size_m;
+};
+
+// A number broadcast to every position; it takes its size from the other
+// operand.
+template<typename T>
+class my_expr_scalar {
+public:
+    static constexpr bool scalar = true;
+
+    explicit my_expr_scalar(T value) : value_m(value) {}
+
+    T operator[](size_t) const {
+        return value_m;
+    }
+
+private:
+    T value_m;
+};
+
+template<typename Op, typename L, typename R>
+class my_expr_binary {
+public:
+    using my_expression_tag = void;
+    static constexpr bool scalar = false;
+
+    my_expr_binary(const L &lhs, const R &rhs) : lhs_m(lhs), rhs_m(rhs) {
+        if constexpr (L::scalar) {
+            size_m = rhs.size();
+        } else if constexpr (R::scalar) {
+            size_m = lhs.size();
+        } else {
+            if (lhs.size() != rhs.size()) {
+                throw std::invalid_argument("The operand sizes do not match!");
+            }
+            size_m = lhs.size();
+        }
+    }
+
+    [[nodiscard]] size_t size() const {
+        return size_m;
+    }
+
+    auto operator[](size_t index) const {
+        return Op()(lhs_m[index], rhs_m[index]);
+    }
+
+private:
+    L lhs_m;
+    R rhs_m;
+    size_t size_m;
+};
+
+template<typename Op, typename E>
+class my_expr_unary {
+public:
+    using my_expression_tag = void;
+    static constexpr bool scalar = false;
+
+    explicit my_expr_unary(const E &operand) : operand_m(operand) {}
+
+    [[nodiscard]] size_t size() const {
+        return operand_m.size();
+    }
+
+    auto operator[](size_t index) const {
+        return Op()(operand_m[index]);
+    }
+
+private:
+    E operand_m;
+};
+
+// Turns an operator argument into a tree node.
+template<my_expr_operand A>
+auto my_expr_node(const A &arg) {
+    if constexpr (my_expression<A>) {
+        return arg;
+    } else if constexpr (std::is_arithmetic_v<A>) {
+        return my_expr_scalar<A>(arg);
+    } else {
+        return my_expr_leaf<typename my_expr_container_traits<A>::value_type>(arg.cbegin(), arg.size());
+    }
+}
+
+template<typename Op, typename L, typename R>
+auto my_expr_make(const L &lhs, const R &rhs) {
+    using left = decltype(my_expr_node(lhs));
+    using right = decltype(my_expr_node(rhs));
+    return my_expr_binary<Op, left, right>(my_expr_node(lhs), my_expr_node(rhs));
+}
+
+// At least one side has to be a vector, an array or an expression; plain
+// number arithmetic never reaches these templates.
+template<typename L, typename R>
+concept my_expr_operands = my_expr_operand<L> && my_expr_operand<R> &&
+                           !(std::is_arithmetic_v<L> && std::is_arithmetic_v<R>);
+
+template<typename L, typename R> requires my_expr_operands<L, R>
+auto operator+(const L &lhs, const R &rhs) {
+    return my_expr_make<std::plus<>>(lhs, rhs);
+}
+
+template<typename L, typename R> requires my_expr_operands<L, R>
+auto operator-(const L &lhs, const R &rhs) {
+    return my_expr_make<std::minus<>>(lhs, rhs);
+}
+
+template<typename L, typename R> requires my_expr_operands<L, R>
+auto operator*(const L &lhs, const R &rhs) {
+    return my_expr_make<std::multiplies<>>(lhs, rhs);
+}
+
+template<typename L, typename R> requires my_expr_operands<L, R>
+auto operator/(const L &lhs, const R &rhs) {
+    return my_expr_make<std::divides<>>(lhs, rhs);
+}
+
+template<typename E> requires my_expression<E> || my_expr_container<E>
+auto operator-(const E &operand) {
+    using node = decltype(my_expr_node(operand));
+    return my_expr_unary<std::negate<>, node>(my_expr_node(operand));
+}
+
+// Compound assignment evaluates target op rhs back into target in place.
+template<my_expr_container Target, my_expr_operand R>
+Target& operator+=(Target &target, const R &rhs) {
+    target = target + rhs;
+    return target;
+}
+
+template<my_expr_container Target, my_expr_operand R>
+Target& operator-=(Target &target, const R &rhs) {
+    target = target - rhs;
+    return target;
+}
+
+template<my_expr_container Target, my_expr_operand R>
+Target& operator*=(Target &target, const R &rhs) {
+    target = target * rhs;
+    return target;
+}
+
+template<my_expr_container Target, my_expr_operand R>
+Target& operator/=(Target &target, const R &rhs) {
+    target = target / rhs;
+    return target;
+}
+
+#endif //MY_VECTOR_MY_EXPR_HPP
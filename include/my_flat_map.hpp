@@ -0,0 +1,316 @@
+#ifndef MY_VECTOR_MY_FLAT_MAP_HPP
+#define MY_VECTOR_MY_FLAT_MAP_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "my_span.hpp"
+#include "my_vector.hpp"
+
+// Branchless lower bound over a sorted contiguous range: the loop body has no
+// data-dependent jump, so the compiler can turn it into a conditional move.
+template<typename T, typename Compare>
+size_t my_branchless_lower_bound(const T* first, size_t n, const T &key, Compare comp) {
+    if (n == 0) {
+        return 0;
+    }
+    const T* base = first;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = comp(base[half], key) ? base + half : base;
+        n -= half;
+    }
+    return (base - first) + (comp(*base, key) ? 1 : 0);
+}
+
+
+template<typename K, typename Compare = std::less<K>>
+class my_flat_set {
+public:
+    my_flat_set()=default;
+
+    my_flat_set(const std::initializer_list<K> &list) {
+        insert(list.begin(), list.end());
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return keys_m.is_empty();
+    }
+
+    [[nodiscard]] size_t size() const {
+        return keys_m.size();
+    }
+
+    void reserve(size_t value) {
+        keys_m.reserve(value);
+    }
+
+    void clear() {
+        keys_m.clear();
+    }
+
+    [[nodiscard]] size_t lower_bound(const K &key) const {
+        return my_branchless_lower_bound(keys_m.cbegin(), keys_m.size(), key, comp_m);
+    }
+
+    [[nodiscard]] bool contains(const K &key) const {
+        size_t index = lower_bound(key);
+        return index < keys_m.size() && !comp_m(key, keys_m[index]);
+    }
+
+    [[nodiscard]] size_t count(const K &key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    const K* find(const K &key) const {
+        return contains(key) ? keys_m.cbegin() + lower_bound(key) : cend();
+    }
+
+    bool insert(const K &key) {
+        size_t index = lower_bound(key);
+        if (index < keys_m.size() && !comp_m(key, keys_m[index])) {
+            return false;
+        }
+        keys_m.insert(keys_m.begin() + index, key);
+        return true;
+    }
+
+    // Appends the whole batch, sorts only the appended tail and merges it
+    // with the existing keys once, instead of shifting the tail per element.
+    template<typename Iter>
+    void insert(Iter first, Iter last) {
+        size_t old_size = keys_m.size();
+        keys_m.reserve(old_size + std::distance(first, last));
+        while (first != last) {
+            keys_m.push_back(*first);
+            ++first;
+        }
+        K* middle = keys_m.begin() + old_size;
+        std::stable_sort(middle, keys_m.end(), comp_m);
+        std::inplace_merge(keys_m.begin(), middle, keys_m.end(), comp_m);
+        K* new_end = std::unique(keys_m.begin(), keys_m.end(), [this](const K &lhs, const K &rhs) {
+            return !comp_m(lhs, rhs) && !comp_m(rhs, lhs);
+        });
+        keys_m.erase(new_end, keys_m.end());
+    }
+
+    void insert(my_span<const K> batch) {
+        insert(batch.begin(), batch.end());
+    }
+
+    bool erase(const K &key) {
+        size_t index = lower_bound(key);
+        if (index == keys_m.size() || comp_m(key, keys_m[index])) {
+            return false;
+        }
+        keys_m.erase(index);
+        return true;
+    }
+
+    const K& operator[](size_t index) const {
+        return keys_m[index];
+    }
+
+    const K* cbegin() const {
+        return keys_m.cbegin();
+    }
+
+    const K* cend() const {
+        return keys_m.cend();
+    }
+
+    const K* begin() const {
+        return keys_m.cbegin();
+    }
+
+    const K* end() const {
+        return keys_m.cend();
+    }
+
+    const my_vector<K>& keys() const {
+        return keys_m;
+    }
+
+private:
+    my_vector<K> keys_m;
+    Compare comp_m;
+};
+
+
+template<typename K, typename V, typename Compare = std::less<K>>
+class my_flat_map {
+public:
+    my_flat_map()=default;
+
+    my_flat_map(const std::initializer_list<std::pair<K, V>> &list) {
+        insert(list.begin(), list.end());
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return keys_m.is_empty();
+    }
+
+    [[nodiscard]] size_t size() const {
+        return keys_m.size();
+    }
+
+    void reserve(size_t value) {
+        keys_m.reserve(value);
+        values_m.reserve(value);
+    }
+
+    void clear() {
+        keys_m.clear();
+        values_m.clear();
+    }
+
+    [[nodiscard]] size_t lower_bound(const K &key) const {
+        return my_branchless_lower_bound(keys_m.cbegin(), keys_m.size(), key, comp_m);
+    }
+
+    [[nodiscard]] bool contains(const K &key) const {
+        size_t index = lower_bound(key);
+        return index < keys_m.size() && !comp_m(key, keys_m[index]);
+    }
+
+    [[nodiscard]] size_t count(const K &key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    V* find(const K &key) {
+        size_t index = lower_bound(key);
+        if (index == keys_m.size() || comp_m(key, keys_m[index])) {
+            return nullptr;
+        }
+        return values_m.begin() + index;
+    }
+
+    const V* find(const K &key) const {
+        size_t index = lower_bound(key);
+        if (index == keys_m.size() || comp_m(key, keys_m[index])) {
+            return nullptr;
+        }
+        return values_m.cbegin() + index;
+    }
+
+    V& at(const K &key) {
+        V* value = find(key);
+        if (value == nullptr) {
+            throw std::out_of_range("The key is not in the map!");
+        }
+        return *value;
+    }
+
+    const V& at(const K &key) const {
+        const V* value = find(key);
+        if (value == nullptr) {
+            throw std::out_of_range("The key is not in the map!");
+        }
+        return *value;
+    }
+
+    V& operator[](const K &key) {
+        size_t index = lower_bound(key);
+        if (index == keys_m.size() || comp_m(key, keys_m[index])) {
+            keys_m.insert(keys_m.begin() + index, key);
+            values_m.insert(values_m.begin() + index, V());
+        }
+        return values_m[index];
+    }
+
+    bool insert(const K &key, const V &value) {
+        size_t index = lower_bound(key);
+        if (index < keys_m.size() && !comp_m(key, keys_m[index])) {
+            return false;
+        }
+        keys_m.insert(keys_m.begin() + index, key);
+        values_m.insert(values_m.begin() + index, value);
+        return true;
+    }
+
+    // Inserts a range of (key, value) pairs with a single sort of the batch
+    // and a single merge pass. As with insert(key, value), keys that are
+    // already present (or repeated in the batch) keep their first value.
+    template<typename Iter>
+    void insert(Iter first, Iter last) {
+        size_t batch_size = std::distance(first, last);
+        my_vector<K> batch_keys;
+        my_vector<V> batch_values;
+        my_vector<size_t> order;
+        batch_keys.reserve(batch_size);
+        batch_values.reserve(batch_size);
+        order.reserve(batch_size);
+        for (size_t i = 0; first != last; ++first, ++i) {
+            batch_keys.push_back(first->first);
+            batch_values.push_back(first->second);
+            order.push_back(i);
+        }
+        std::stable_sort(order.begin(), order.end(), [this, &batch_keys](size_t lhs, size_t rhs) {
+            return comp_m(batch_keys[lhs], batch_keys[rhs]);
+        });
+
+        my_vector<K> merged_keys;
+        my_vector<V> merged_values;
+        merged_keys.reserve(keys_m.size() + batch_size);
+        merged_values.reserve(keys_m.size() + batch_size);
+        size_t i = 0;
+        size_t j = 0;
+        while (i < keys_m.size() || j < batch_size) {
+            bool take_old = j == batch_size ||
+                    (i < keys_m.size() && !comp_m(batch_keys[order[j]], keys_m[i]));
+            const K &key = take_old ? keys_m[i] : batch_keys[order[j]];
+            if (merged_keys.is_empty() || comp_m(merged_keys.back(), key)) {
+                merged_keys.push_back(key);
+                merged_values.push_back(take_old ? values_m[i] : batch_values[order[j]]);
+            }
+            if (take_old) {
+                ++i;
+            } else {
+                ++j;
+            }
+        }
+        keys_m.swap(merged_keys);
+        values_m.swap(merged_values);
+    }
+
+    bool erase(const K &key) {
+        size_t index = lower_bound(key);
+        if (index == keys_m.size() || comp_m(key, keys_m[index])) {
+            return false;
+        }
+        keys_m.erase(index);
+        values_m.erase(index);
+        return true;
+    }
+
+    const K& key_at(size_t index) const {
+        return keys_m[index];
+    }
+
+    V& value_at(size_t index) {
+        return values_m[index];
+    }
+
+    const V& value_at(size_t index) const {
+        return values_m[index];
+    }
+
+    const my_vector<K>& keys() const {
+        return keys_m;
+    }
+
+    const my_vector<V>& values() const {
+        return values_m;
+    }
+
+private:
+    my_vector<K> keys_m;
+    my_vector<V> values_m;
+    Compare comp_m;
+};
+
+#endif //MY_VECTOR_MY_FLAT_MAP_HPP
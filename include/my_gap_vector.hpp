@@ -0,0 +1,383 @@
+#ifndef MY_VECTOR_MY_GAP_VECTOR_HPP
+#define MY_VECTOR_MY_GAP_VECTOR_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "my_span.hpp"
+#include "my_vector.hpp"
+
+// Gap buffer: a sequence whose unused capacity sits as a gap at the last
+// edit point instead of at the end. Inserting or erasing at the gap is O(1)
+// amortized; editing elsewhere first moves the gap there, which costs only
+// the distance moved. So bursts of edits around one cursor stay cheap on
+// large sequences.
+//
+// The buffer is a my_vector whose whole capacity is in use:
+// [0, gap_begin) holds the elements before the gap and [gap_end, capacity)
+// the elements after it. Indices and iterators are logical, so they skip
+// the gap. contiguous() closes the gap for callers that need one span.
+template<typename T>
+class my_gap_vector {
+    template<bool Const>
+    class basic_iterator;
+
+public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    my_gap_vector() : gap_begin_m(0), gap_end_m(0) {};
+
+    my_gap_vector(const int &n, const T &d) : my_gap_vector() {
+        grow(n);
+        std::fill_n(buffer_m.begin(), n, d);
+        gap_begin_m = n;
+    }
+
+    template<typename Iter>
+    my_gap_vector(Iter start_interval, Iter end_interval) : my_gap_vector() {
+        grow(std::distance(start_interval, end_interval));
+        gap_begin_m = std::copy(start_interval, end_interval, buffer_m.begin()) - buffer_m.begin();
+    }
+
+    explicit my_gap_vector(my_span<const T> items) : my_gap_vector(items.begin(), items.end()) {}
+
+    my_gap_vector(const std::initializer_list<T> &arg) : my_gap_vector(arg.begin(), arg.end()) {}
+
+    T& operator[](size_t index) noexcept {
+        return buffer_m[physical(index)];
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return buffer_m[physical(index)];
+    }
+
+    T& at(size_t index) {
+        check_index(index);
+        return buffer_m[physical(index)];
+    }
+
+    const T& at(size_t index) const {
+        check_index(index);
+        return buffer_m[physical(index)];
+    }
+
+    T& front() {
+        return (*this)[0];
+    }
+
+    const T& front() const {
+        return (*this)[0];
+    }
+
+    T& back() {
+        return (*this)[size() - 1];
+    }
+
+    const T& back() const {
+        return (*this)[size() - 1];
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return size() == 0;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return buffer_m.size() - gap_size();
+    }
+
+    [[nodiscard]] size_t capacity() const {
+        return buffer_m.size();
+    }
+
+    // Logical index the gap currently sits before.
+    [[nodiscard]] size_t gap_position() const {
+        return gap_begin_m;
+    }
+
+    void reserve(size_t value) {
+        if (value > capacity()) {
+            grow(value - size());
+        }
+    }
+
+    // Moves the gap so that it sits before element pos; shifts only the
+    // elements between the old and the new position.
+    void move_gap(size_t pos) {
+        if (pos > size()) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        if (gap_size() == 0) {
+            // nothing to shift; the elements would only be moved onto
+            // themselves, which empties types such as std::string
+            gap_begin_m = gap_end_m = pos;
+            return;
+        }
+        T* data = buffer_m.begin();
+        if (pos < gap_begin_m) {
+            size_t count = gap_begin_m - pos;
+            std::move_backward(data + pos, data + gap_begin_m, data + gap_end_m);
+            gap_begin_m -= count;
+            gap_end_m -= count;
+        } else if (pos > gap_begin_m) {
+            size_t count = pos - gap_begin_m;
+            std::move(data + gap_end_m, data + gap_end_m + count, data + gap_begin_m);
+            gap_begin_m += count;
+            gap_end_m += count;
+        }
+    }
+
+    void insert(size_t pos, const T &value) {
+        // value may refer to an element that moving the gap shifts
+        insert(pos, T(value));
+    }
+
+    void insert(size_t pos, T &&value) {
+        move_gap(pos);
+        grow(1);
+        buffer_m[gap_begin_m++] = std::move(value);
+    }
+
+    void insert(size_t pos, my_span<const T> items) {
+        if (aliases(items)) {
+            // moving the gap or growing would shift or free the source
+            my_vector<T> copy(items.begin(), items.end());
+            insert(pos, my_span<const T>(copy));
+            return;
+        }
+        move_gap(pos);
+        grow(items.size());
+        std::copy(items.begin(), items.end(), buffer_m.begin() + gap_begin_m);
+        gap_begin_m += items.size();
+    }
+
+    // Erases count elements starting at pos by widening the gap over them.
+    void erase(size_t pos, size_t count = 1) {
+        if (pos + count > size()) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        move_gap(pos);
+        for (size_t i = 0; i < count; ++i) {
+            // slots live until the buffer goes away, so they are reset
+            buffer_m[gap_end_m++] = T();
+        }
+    }
+
+    void push_back(const T &value) {
+        insert(size(), value);
+    }
+
+    void push_back(T &&value) {
+        insert(size(), std::move(value));
+    }
+
+    void pop_back() {
+        erase(size() - 1);
+    }
+
+    void clear() {
+        for (size_t i = 0; i < size(); ++i) {
+            (*this)[i] = T();
+        }
+        gap_begin_m = 0;
+        gap_end_m = capacity();
+    }
+
+    // Moves the gap to the end and returns all elements as one span.
+    my_span<T> contiguous() {
+        move_gap(size());
+        return my_span<T>(buffer_m.begin(), gap_begin_m);
+    }
+
+    // The elements on each side of the gap, without moving anything.
+    my_span<const T> before_gap() const {
+        return my_span<const T>(buffer_m.cbegin(), gap_begin_m);
+    }
+
+    my_span<const T> after_gap() const {
+        return my_span<const T>(buffer_m.cbegin() + gap_end_m, capacity() - gap_end_m);
+    }
+
+    my_vector<T> to_vector() const {
+        my_vector<T> result;
+        result.reserve(size());
+        result.insert(result.end(), before_gap());
+        result.insert(result.end(), after_gap());
+        return result;
+    }
+
+    iterator begin() {
+        return iterator(buffer_m.begin(), 0, gap_begin_m, gap_size());
+    }
+
+    iterator end() {
+        return iterator(buffer_m.begin(), size(), gap_begin_m, gap_size());
+    }
+
+    const_iterator cbegin() const {
+        return const_iterator(buffer_m.cbegin(), 0, gap_begin_m, gap_size());
+    }
+
+    const_iterator cend() const {
+        return const_iterator(buffer_m.cbegin(), size(), gap_begin_m, gap_size());
+    }
+
+    friend bool operator==(const my_gap_vector &lhs, const my_gap_vector &rhs) {
+        return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+    }
+
+    friend bool operator!=(const my_gap_vector &lhs, const my_gap_vector &rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    // Random access over the logical positions; the physical slot of index
+    // i is i below the gap and i + gap size above it.
+    template<bool Const>
+    class basic_iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() : data_m(nullptr), index_m(0), gap_begin_m(0), gap_size_m(0) {}
+
+        basic_iterator(pointer data, size_t index, size_t gap_begin, size_t gap_size) :
+                data_m(data), index_m(index), gap_begin_m(gap_begin), gap_size_m(gap_size) {}
+
+        // iterator converts to const_iterator
+        template<bool OtherConst> requires (Const && !OtherConst)
+        basic_iterator(const basic_iterator<OtherConst> &other) :
+                data_m(other.data_m), index_m(other.index_m),
+                gap_begin_m(other.gap_begin_m), gap_size_m(other.gap_size_m) {}
+
+        reference operator*() const {
+            return data_m[index_m < gap_begin_m ? index_m : index_m + gap_size_m];
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        reference operator[](difference_type offset) const {
+            return *(*this + offset);
+        }
+
+        basic_iterator& operator++() {
+            ++index_m;
+            return *this;
+        }
+
+        basic_iterator operator++(int) {
+            basic_iterator old = *this;
+            ++index_m;
+            return old;
+        }
+
+        basic_iterator& operator--() {
+            --index_m;
+            return *this;
+        }
+
+        basic_iterator operator--(int) {
+            basic_iterator old = *this;
+            --index_m;
+            return old;
+        }
+
+        basic_iterator& operator+=(difference_type offset) {
+            index_m += offset;
+            return *this;
+        }
+
+        basic_iterator& operator-=(difference_type offset) {
+            index_m -= offset;
+            return *this;
+        }
+
+        friend basic_iterator operator+(basic_iterator it, difference_type offset) {
+            return it += offset;
+        }
+
+        friend basic_iterator operator+(difference_type offset, basic_iterator it) {
+            return it += offset;
+        }
+
+        friend basic_iterator operator-(basic_iterator it, difference_type offset) {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return static_cast<difference_type>(lhs.index_m) - static_cast<difference_type>(rhs.index_m);
+        }
+
+        friend bool operator==(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return lhs.index_m == rhs.index_m;
+        }
+
+        friend std::strong_ordering operator<=>(const basic_iterator &lhs, const basic_iterator &rhs) {
+            return lhs.index_m <=> rhs.index_m;
+        }
+
+    private:
+        template<bool>
+        friend class basic_iterator;
+
+        pointer data_m;
+        size_t index_m;
+        size_t gap_begin_m;
+        size_t gap_size_m;
+    };
+
+    [[nodiscard]] size_t gap_size() const {
+        return gap_end_m - gap_begin_m;
+    }
+
+    [[nodiscard]] size_t physical(size_t index) const {
+        return index < gap_begin_m ? index : index + gap_size();
+    }
+
+    void check_index(size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("The index is out of range!");
+        }
+    }
+
+    // whether items points into this gap vector's own buffer
+    [[nodiscard]] bool aliases(my_span<const T> items) const {
+        std::less<const T*> before;
+        const T* first = buffer_m.cbegin();
+        const T* last = first + buffer_m.size();
+        return !items.is_empty() && !before(items.begin(), first) && before(items.begin(), last);
+    }
+
+    // Makes the gap at least extra slots wide, at least doubling the buffer
+    // when it has to be reallocated.
+    void grow(size_t extra) {
+        if (gap_size() >= extra) {
+            return;
+        }
+        size_t tail = capacity() - gap_end_m;
+        size_t new_capacity = std::max({capacity() * 2, size() + extra, size_t(16)});
+        my_vector<T> fresh;
+        fresh.resize_with(new_capacity, [](T*, size_t) {});
+        std::move(buffer_m.begin(), buffer_m.begin() + gap_begin_m, fresh.begin());
+        std::move(buffer_m.begin() + gap_end_m, buffer_m.end(), fresh.end() - tail);
+        gap_end_m = new_capacity - tail;
+        buffer_m = std::move(fresh);
+    }
+
+    my_vector<T> buffer_m;
+    size_t gap_begin_m;
+    size_t gap_end_m;
+};
+
+#endif //MY_VECTOR_MY_GAP_VECTOR_HPP
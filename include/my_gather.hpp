@@ -0,0 +1,223 @@
+#ifndef MY_VECTOR_MY_GATHER_HPP
+#define MY_VECTOR_MY_GATHER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "my_simd.hpp"
+#include "my_vector.hpp"
+
+// Index-based bulk access: gather builds out[i] = src[indices[i]], scatter
+// writes dst[indices[i]] = values[i]. Both accept my_vector, my_array or
+// my_span for every argument. With 32-bit indices and 4- or 8-byte elements
+// the hardware gather (AVX2, AVX-512) and scatter (AVX-512) instructions are
+// used when the running CPU has them; the choice is made at run time.
+
+// Sources bigger than this are assumed not to fit in cache, so upcoming
+// random accesses are prefetched this many elements ahead.
+inline constexpr size_t my_gather_prefetch_bytes = size_t(4) << 20;
+inline constexpr size_t my_gather_prefetch_distance = 32;
+
+template<typename C>
+concept my_contiguous_range = requires(const C &c) {
+    { c.cbegin() } -> std::convertible_to<const void*>;
+    { c.size() } -> std::convertible_to<size_t>;
+};
+
+#ifdef MY_SIMD_X86
+__attribute__((target("avx2")))
+inline size_t my_gather32_avx2(const void* src, const uint32_t* idx, size_t n, void* out, bool prefetch) {
+    const auto* base = static_cast<const int*>(src);
+    auto* target = static_cast<int*>(out);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        if (prefetch && i + my_gather_prefetch_distance + 8 <= n) {
+            for (size_t k = 0; k < 8; ++k) {
+                __builtin_prefetch(base + idx[i + my_gather_prefetch_distance + k]);
+            }
+        }
+        __m256i vi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), _mm256_i32gather_epi32(base, vi, 4));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline size_t my_gather64_avx2(const void* src, const uint32_t* idx, size_t n, void* out, bool prefetch) {
+    const auto* base = static_cast<const long long*>(src);
+    auto* target = static_cast<long long*>(out);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        if (prefetch && i + my_gather_prefetch_distance + 4 <= n) {
+            for (size_t k = 0; k < 4; ++k) {
+                __builtin_prefetch(base + idx[i + my_gather_prefetch_distance + k]);
+            }
+        }
+        __m128i vi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), _mm256_i32gather_epi64(base, vi, 8));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+inline size_t my_gather32_avx512(const void* src, const uint32_t* idx, size_t n, void* out, bool prefetch) {
+    const auto* base = static_cast<const int*>(src);
+    auto* target = static_cast<int*>(out);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        if (prefetch && i + my_gather_prefetch_distance + 16 <= n) {
+            for (size_t k = 0; k < 16; ++k) {
+                __builtin_prefetch(base + idx[i + my_gather_prefetch_distance + k]);
+            }
+        }
+        __m512i vi = _mm512_loadu_si512(idx + i);
+        _mm512_storeu_si512(target + i, _mm512_i32gather_epi32(vi, base, 4));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+inline size_t my_gather64_avx512(const void* src, const uint32_t* idx, size_t n, void* out, bool prefetch) {
+    const auto* base = static_cast<const long long*>(src);
+    auto* target = static_cast<long long*>(out);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        if (prefetch && i + my_gather_prefetch_distance + 8 <= n) {
+            for (size_t k = 0; k < 8; ++k) {
+                __builtin_prefetch(base + idx[i + my_gather_prefetch_distance + k]);
+            }
+        }
+        __m256i vi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + i));
+        _mm512_storeu_si512(target + i, _mm512_i32gather_epi64(vi, base, 8));
+    }
+    return i;
+}
+
+// AVX-512 scatters store lanes from the lowest to the highest, so with
+// repeated indices the last value wins, exactly as in the scalar loop.
+__attribute__((target("avx512f")))
+inline size_t my_scatter32_avx512(void* dst, const uint32_t* idx, size_t n, const void* values) {
+    auto* base = static_cast<int*>(dst);
+    const auto* source = static_cast<const int*>(values);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i vi = _mm512_loadu_si512(idx + i);
+        _mm512_i32scatter_epi32(base, vi, _mm512_loadu_si512(source + i), 4);
+    }
+    return i;
+}
+
+__attribute__((target("avx512f")))
+inline size_t my_scatter64_avx512(void* dst, const uint32_t* idx, size_t n, const void* values) {
+    auto* base = static_cast<long long*>(dst);
+    const auto* source = static_cast<const long long*>(values);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i vi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx + i));
+        _mm512_i32scatter_epi64(base, vi, _mm512_loadu_si512(source + i), 8);
+    }
+    return i;
+}
+#endif
+
+// One branch-free pass over the indices, so it vectorizes; negative signed
+// indices wrap to huge unsigned values and fail the same comparison.
+template<typename Index>
+void my_check_indices(const Index* idx, size_t n, size_t limit) {
+    static_assert(std::is_integral_v<Index>, "indices must be integers");
+    size_t max_index = 0;
+    for (size_t i = 0; i < n; ++i) {
+        max_index = std::max(max_index, static_cast<size_t>(idx[i]));
+    }
+    if (n != 0 && max_index >= limit) {
+        throw std::out_of_range("The index is out of range!");
+    }
+}
+
+// out[i] = src[idx[i]] for i < n; indices must already be checked.
+template<typename T, typename Index>
+void my_gather_unchecked(const T* src, size_t src_size, const Index* idx, size_t n, T* out,
+                         my_simd_level level = my_detect_simd_level()) {
+    bool prefetch = src_size * sizeof(T) >= my_gather_prefetch_bytes;
+    level = std::min(level, my_detect_simd_level());
+    size_t i = 0;
+#ifdef MY_SIMD_X86
+    if constexpr (std::is_trivially_copyable_v<T> && (sizeof(T) == 4 || sizeof(T) == 8) &&
+                  std::is_same_v<std::make_unsigned_t<Index>, uint32_t>) {
+        // the gather instructions take signed 32-bit offsets
+        if (src_size <= size_t(std::numeric_limits<int32_t>::max())) {
+            const auto* uidx = reinterpret_cast<const uint32_t*>(idx);
+            if (level == my_simd_level::avx512) {
+                i = sizeof(T) == 4 ? my_gather32_avx512(src, uidx, n, out, prefetch)
+                                   : my_gather64_avx512(src, uidx, n, out, prefetch);
+            } else if (level == my_simd_level::avx2) {
+                i = sizeof(T) == 4 ? my_gather32_avx2(src, uidx, n, out, prefetch)
+                                   : my_gather64_avx2(src, uidx, n, out, prefetch);
+            }
+        }
+    }
+#else
+    (void) level;
+#endif
+    for (; i < n; ++i) {
+        if (prefetch && i + my_gather_prefetch_distance < n) {
+            __builtin_prefetch(src + idx[i + my_gather_prefetch_distance]);
+        }
+        out[i] = src[idx[i]];
+    }
+}
+
+// dst[idx[i]] = values[i] for i < n; indices must already be checked.
+template<typename T, typename Index>
+void my_scatter_unchecked(T* dst, size_t dst_size, const Index* idx, size_t n, const T* values,
+                          my_simd_level level = my_detect_simd_level()) {
+    bool prefetch = dst_size * sizeof(T) >= my_gather_prefetch_bytes;
+    level = std::min(level, my_detect_simd_level());
+    size_t i = 0;
+#ifdef MY_SIMD_X86
+    if constexpr (std::is_trivially_copyable_v<T> && (sizeof(T) == 4 || sizeof(T) == 8) &&
+                  std::is_same_v<std::make_unsigned_t<Index>, uint32_t>) {
+        if (level == my_simd_level::avx512 && dst_size <= size_t(std::numeric_limits<int32_t>::max())) {
+            const auto* uidx = reinterpret_cast<const uint32_t*>(idx);
+            i = sizeof(T) == 4 ? my_scatter32_avx512(dst, uidx, n, values)
+                               : my_scatter64_avx512(dst, uidx, n, values);
+        }
+    }
+#else
+    (void) level;
+#endif
+    for (; i < n; ++i) {
+        if (prefetch && i + my_gather_prefetch_distance < n) {
+            __builtin_prefetch(dst + idx[i + my_gather_prefetch_distance], 1);
+        }
+        dst[idx[i]] = values[i];
+    }
+}
+
+template<my_contiguous_range Source, my_contiguous_range Indices>
+auto my_gather(const Source &src, const Indices &indices) {
+    using T = std::remove_cvref_t<decltype(*src.cbegin())>;
+    size_t n = indices.size();
+    my_check_indices(indices.cbegin(), n, src.size());
+    my_vector<T> result;
+    result.resize_with(n, [&](T* out, size_t) {
+        my_gather_unchecked(src.cbegin(), src.size(), indices.cbegin(), n, out);
+    });
+    return result;
+}
+
+template<typename Dest, my_contiguous_range Indices, my_contiguous_range Values>
+void my_scatter(Dest &&dst, const Indices &indices, const Values &values) {
+    size_t n = indices.size();
+    if (values.size() != n) {
+        throw std::invalid_argument("Indices and values have different sizes!");
+    }
+    my_check_indices(indices.cbegin(), n, dst.size());
+    my_scatter_unchecked(dst.begin(), dst.size(), indices.cbegin(), n, values.cbegin());
+}
+
+#endif //MY_VECTOR_MY_GATHER_HPP
@@ -0,0 +1,206 @@
+#ifndef MY_VECTOR_MY_HASH_HPP
+#define MY_VECTOR_MY_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "my_array.hpp"
+#include "my_vector.hpp"
+
+// wyhash-style byte hash: 48 bytes per step in three independent lanes,
+// each mixed with a 64x64->128 bit multiply folded back to 64 bits.
+inline uint64_t my_hash_mix(uint64_t a, uint64_t b) {
+    __uint128_t r = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+}
+
+inline uint64_t my_hash_read64(const unsigned char* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t my_hash_read32(const unsigned char* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t my_hash_bytes(const void* data, size_t len, uint64_t seed = 0) {
+    constexpr uint64_t s0 = 0xa0761d6478bd642full;
+    constexpr uint64_t s1 = 0xe7037ed1a0b428dbull;
+    constexpr uint64_t s2 = 0x8ebc6af09c88c6e3ull;
+    constexpr uint64_t s3 = 0x589965cc75374cc3ull;
+    const auto* p = static_cast<const unsigned char*>(data);
+    seed ^= my_hash_mix(seed ^ s0, s1);
+    uint64_t a;
+    uint64_t b;
+    if (len <= 16) {
+        if (len >= 4) {
+            size_t shift = (len >> 3) << 2;
+            a = (my_hash_read32(p) << 32) | my_hash_read32(p + shift);
+            b = (my_hash_read32(p + len - 4) << 32) | my_hash_read32(p + len - 4 - shift);
+        } else if (len > 0) {
+            a = (uint64_t(p[0]) << 16) | (uint64_t(p[len >> 1]) << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i > 48) {
+            uint64_t lane1 = seed;
+            uint64_t lane2 = seed;
+            do {
+                seed = my_hash_mix(my_hash_read64(p) ^ s1, my_hash_read64(p + 8) ^ seed);
+                lane1 = my_hash_mix(my_hash_read64(p + 16) ^ s2, my_hash_read64(p + 24) ^ lane1);
+                lane2 = my_hash_mix(my_hash_read64(p + 32) ^ s3, my_hash_read64(p + 40) ^ lane2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (i > 16) {
+            seed = my_hash_mix(my_hash_read64(p) ^ s1, my_hash_read64(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = my_hash_read64(p + i - 16);
+        b = my_hash_read64(p + i - 8);
+    }
+    __uint128_t r = static_cast<__uint128_t>(a ^ s1) * (b ^ seed);
+    return my_hash_mix(static_cast<uint64_t>(r) ^ s0 ^ len, static_cast<uint64_t>(r >> 64) ^ s1);
+}
+
+// Hash of a contiguous range. Types whose equal values always have equal
+// bytes (no padding, no +0/-0 style duplicates) are hashed as one block;
+// everything else combines std::hash of each element.
+template<typename T>
+size_t my_hash_range(const T* first, size_t n) {
+    if constexpr (std::has_unique_object_representations_v<T>) {
+        return my_hash_bytes(first, n * sizeof(T));
+    } else {
+        uint64_t result = my_hash_mix(n, 0x9e3779b97f4a7c15ull);
+        for (size_t i = 0; i < n; ++i) {
+            result = my_hash_mix(result ^ std::hash<T>()(first[i]), 0xe7037ed1a0b428dbull);
+        }
+        return result;
+    }
+}
+
+template<typename T>
+struct std::hash<my_vector<T>> {
+    size_t operator()(const my_vector<T> &vec) const {
+        return my_hash_range(vec.cbegin(), vec.size());
+    }
+};
+
+template<typename T, size_t N>
+struct std::hash<my_array<T, N>> {
+    size_t operator()(const my_array<T, N> &arr) const {
+        return my_hash_range(arr.cbegin(), N);
+    }
+};
+
+
+// Wraps a container and remembers its hash until the next mutation. Reads
+// go through get(); any change has to go through mutate() or modify(),
+// which drop the cached value. The reference mutate() returns must not be
+// kept: changes made through it later would leave a stale hash behind.
+// hash() and comparisons may run on several threads at once; the cache is
+// atomic, and racing threads just compute the same value.
+template<typename Container>
+class my_hashed {
+public:
+    my_hashed() : hash_m(0), hash_valid_m(false) {};
+
+    explicit my_hashed(Container value) : value_m(std::move(value)), hash_m(0), hash_valid_m(false) {}
+
+    my_hashed(const my_hashed &other) : value_m(other.value_m), hash_m(0), hash_valid_m(false) {
+        copy_cache(other);
+    }
+
+    my_hashed(my_hashed &&other) noexcept(std::is_nothrow_move_constructible_v<Container>) : value_m(std::move(other.value_m)), hash_m(0), hash_valid_m(false) {
+        copy_cache(other);
+        other.hash_valid_m.store(false, std::memory_order_relaxed);
+    }
+
+    my_hashed &operator=(const my_hashed &other) {
+        if (this != &other) {
+            value_m = other.value_m;
+            copy_cache(other);
+        }
+        return *this;
+    }
+
+    my_hashed &operator=(my_hashed &&other) noexcept(std::is_nothrow_move_assignable_v<Container>) {
+        if (this != &other) {
+            value_m = std::move(other.value_m);
+            copy_cache(other);
+            other.hash_valid_m.store(false, std::memory_order_relaxed);
+        }
+        return *this;
+    }
+
+    const Container& get() const {
+        return value_m;
+    }
+
+    Container& mutate() {
+        hash_valid_m.store(false, std::memory_order_relaxed);
+        return value_m;
+    }
+
+    template<typename Fn>
+    void modify(Fn fn) {
+        hash_valid_m.store(false, std::memory_order_relaxed);
+        fn(value_m);
+    }
+
+    [[nodiscard]] size_t hash() const {
+        if (hash_valid_m.load(std::memory_order_acquire)) {
+            return hash_m.load(std::memory_order_relaxed);
+        }
+        size_t result = std::hash<Container>()(value_m);
+        hash_m.store(result, std::memory_order_relaxed);
+        hash_valid_m.store(true, std::memory_order_release);
+        return result;
+    }
+
+    [[nodiscard]] bool has_cached_hash() const {
+        return hash_valid_m.load(std::memory_order_acquire);
+    }
+
+    friend bool operator==(const my_hashed &lhs, const my_hashed &rhs) {
+        return lhs.hash() == rhs.hash() && lhs.value_m == rhs.value_m;
+    }
+
+    friend bool operator!=(const my_hashed &lhs, const my_hashed &rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    void copy_cache(const my_hashed &other) {
+        bool valid = other.hash_valid_m.load(std::memory_order_acquire);
+        hash_m.store(other.hash_m.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        hash_valid_m.store(valid, std::memory_order_release);
+    }
+
+    Container value_m;
+    mutable std::atomic<size_t> hash_m;
+    mutable std::atomic<bool> hash_valid_m;
+};
+
+template<typename Container>
+struct std::hash<my_hashed<Container>> {
+    size_t operator()(const my_hashed<Container> &value) const {
+        return value.hash();
+    }
+};
+
+#endif //MY_VECTOR_MY_HASH_HPP
@@ -0,0 +1,356 @@
+#ifndef MY_VECTOR_MY_INPLACE_VECTOR_HPP
+#define MY_VECTOR_MY_INPLACE_VECTOR_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "my_array.hpp"
+#include "my_span.hpp"
+
+// Vector with a fixed capacity of N elements stored inline, never allocating.
+// The my_array holds raw, suitably aligned slots, so only the first size()
+// elements are ever constructed. Growing past N throws std::length_error.
+template<typename T, size_t N>
+class my_inplace_vector {
+public:
+    my_inplace_vector() noexcept : size_m(0) {};
+
+    my_inplace_vector(const int &n, const T &d) : size_m(0) {
+        check_capacity(n);
+        std::uninitialized_fill_n(data(), n, d);
+        size_m = n;
+    }
+
+    template<typename Iter>
+    my_inplace_vector(Iter start_interval, Iter end_interval) : size_m(0) {
+        check_capacity(std::distance(start_interval, end_interval));
+        T* end = std::uninitialized_copy(start_interval, end_interval, data());
+        size_m = end - data();
+    }
+
+    explicit my_inplace_vector(my_span<const T> items) : my_inplace_vector(items.begin(), items.end()) {}
+
+    my_inplace_vector(const std::initializer_list<T> &arg) : my_inplace_vector(arg.begin(), arg.end()) {}
+
+    // copy constructor
+    my_inplace_vector(const my_inplace_vector &other) : my_inplace_vector(other.cbegin(), other.cend()) {}
+
+    // move constructor
+    my_inplace_vector(my_inplace_vector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) : size_m(0) {
+        std::uninitialized_move(other.begin(), other.end(), data());
+        size_m = other.size_m;
+        other.clear();
+    }
+
+    // copy assignment
+    my_inplace_vector& operator=(const my_inplace_vector &other) {
+        if (&other != this) {
+            assign_from(other.cbegin(), other.size_m);
+        }
+        return *this;
+    }
+
+    // move assignment
+    my_inplace_vector& operator=(my_inplace_vector &&other) noexcept(std::is_nothrow_move_assignable_v<T> &&
+                                                                     std::is_nothrow_move_constructible_v<T>) {
+        if (&other != this) {
+            size_t common = std::min(size_m, other.size_m);
+            std::move(other.begin(), other.begin() + common, begin());
+            if (other.size_m > size_m) {
+                std::uninitialized_move(other.begin() + common, other.end(), end());
+            } else {
+                std::destroy(begin() + common, end());
+            }
+            size_m = other.size_m;
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~my_inplace_vector() {
+        clear();
+    }
+
+    T& operator[](size_t value) noexcept {
+        return data()[value];
+    }
+
+    const T& operator[](size_t value) const noexcept {
+        return data()[value];
+    }
+
+    T& at(size_t index) {
+        if (index >= size_m) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return data()[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size_m) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return data()[index];
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return size_m == 0;
+    }
+
+    [[nodiscard]] bool is_full() const {
+        return size_m == N;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return size_m;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() {
+        return N;
+    }
+
+    void reserve(size_t value) {
+        check_capacity(value);
+    }
+
+    void shrink_to_fit() {}
+
+    void swap(my_inplace_vector &other) noexcept(std::is_nothrow_swappable_v<T> &&
+                                                 std::is_nothrow_move_constructible_v<T>) {
+        my_inplace_vector &shorter = size_m < other.size_m ? *this : other;
+        my_inplace_vector &longer = size_m < other.size_m ? other : *this;
+        size_t common = shorter.size_m;
+        std::swap_ranges(shorter.begin(), shorter.begin() + common, longer.begin());
+        std::uninitialized_move(longer.begin() + common, longer.end(), shorter.begin() + common);
+        std::destroy(longer.begin() + common, longer.end());
+        std::swap(size_m, other.size_m);
+    }
+
+    void clear() noexcept {
+        std::destroy(begin(), end());
+        size_m = 0;
+    }
+
+    void resize(size_t value, T elem=T()) {
+        if (value == size_m) return;
+        if (value < size_m) {
+            std::destroy(begin() + value, end());
+        } else {
+            check_capacity(value);
+            std::uninitialized_fill(end(), begin() + value, elem);
+        }
+        size_m = value;
+    }
+
+    T* insert(T* pos, const T &value) {
+        size_t index = pos - begin();
+        check_capacity(size_m + 1);
+        if (index == size_m) {
+            new (end()) T(value);
+        } else {
+            T copy(value);
+            new (end()) T(std::move(back()));
+            std::move_backward(begin() + index, end() - 1, end());
+            data()[index] = std::move(copy);
+        }
+        ++size_m;
+        return begin() + index;
+    }
+
+    T* insert(T* pos, const T* begin_take, const T* end_take) {
+        size_t index = pos - begin();
+        size_t count = end_take - begin_take;
+        if (count == 0) {
+            return begin() + index;
+        }
+        check_capacity(size_m + count);
+        T* old_end = end();
+        size_t tail = size_m - index;
+        if (tail > count) {
+            std::uninitialized_move(old_end - count, old_end, old_end);
+            std::move_backward(begin() + index, old_end - count, old_end);
+            std::copy(begin_take, end_take, begin() + index);
+        } else {
+            std::uninitialized_copy(begin_take + tail, end_take, old_end);
+            std::uninitialized_move(begin() + index, old_end, begin() + index + count);
+            std::copy(begin_take, begin_take + tail, begin() + index);
+        }
+        size_m += count;
+        return begin() + index;
+    }
+
+    T* insert(T* pos, my_span<const T> items) {
+        return insert(pos, items.begin(), items.end());
+    }
+
+    T* erase(const size_t pos) {
+        std::move(begin() + pos + 1, end(), begin() + pos);
+        pop_back();
+        return begin() + pos;
+    }
+
+    T* erase(T* begin_, T* end_) {
+        size_t first_ind = begin_ - begin();
+        if (begin_ == end_) {
+            return begin() + first_ind;
+        }
+        T* new_end = std::move(end_, end(), begin_);
+        std::destroy(new_end, end());
+        size_m = new_end - begin();
+        return begin() + first_ind;
+    }
+
+    void pop_back() {
+        std::destroy_at(end() - 1);
+        --size_m;
+    }
+
+    void push_back(const T &value) {
+        check_capacity(size_m + 1);
+        new (end()) T(value);
+        ++size_m;
+    }
+
+    void push_back(T &&value) {
+        check_capacity(size_m + 1);
+        new (end()) T(std::move(value));
+        ++size_m;
+    }
+
+    // Returns false instead of throwing when the vector is full.
+    bool try_push_back(const T &value) {
+        if (size_m == N) {
+            return false;
+        }
+        new (end()) T(value);
+        ++size_m;
+        return true;
+    }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        check_capacity(size_m + 1);
+        T* slot = new (end()) T(std::forward<Args>(args)...);
+        ++size_m;
+        return *slot;
+    }
+
+    friend bool operator==(const my_inplace_vector& lhs, const my_inplace_vector& rhs) {
+        return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+    }
+
+    friend bool operator!=(const my_inplace_vector& lhs, const my_inplace_vector& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const my_inplace_vector& lhs, const my_inplace_vector& rhs) {
+        return std::lexicographical_compare(lhs.cbegin(), lhs.cend(),
+                                            rhs.cbegin(), rhs.cend());
+    }
+
+    friend bool operator<=(const my_inplace_vector& lhs, const my_inplace_vector& rhs) {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>(const my_inplace_vector& lhs, const my_inplace_vector& rhs) {
+        return rhs < lhs;
+    }
+
+    friend bool operator>=(const my_inplace_vector& lhs, const my_inplace_vector& rhs) {
+        return !(lhs < rhs);
+    }
+
+    friend void swap(my_inplace_vector& lhs, my_inplace_vector& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+        lhs.swap(rhs);
+    }
+
+    T* begin() {
+        return data();
+    }
+
+    const T* cbegin() const {
+        return data();
+    }
+
+    T* end() {
+        return data() + size_m;
+    }
+
+    const T* cend() const {
+        return data() + size_m;
+    }
+
+    T& front() {
+        return data()[0];
+    }
+
+    const T& front() const {
+        return data()[0];
+    }
+
+    T& back() {
+        return data()[size_m - 1];
+    }
+
+    const T& back() const {
+        return data()[size_m - 1];
+    }
+
+    std::reverse_iterator<T*> rbegin() {
+        return std::reverse_iterator<T*>(end());
+    }
+
+    std::reverse_iterator<const T*> rcbegin() const {
+        return std::reverse_iterator<const T*>(cend());
+    }
+
+    std::reverse_iterator<T*> rend() {
+        return std::reverse_iterator<T*>(begin());
+    }
+
+    std::reverse_iterator<const T*> rcend() const {
+        return std::reverse_iterator<const T*>(cbegin());
+    }
+
+private:
+    // uninitialized storage for one element; trivially default constructible,
+    // so the my_array below costs nothing to create
+    struct slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    static void check_capacity(size_t value) {
+        if (value > N) {
+            throw std::length_error("The inplace vector capacity is exceeded!");
+        }
+    }
+
+    T* data() {
+        return std::launder(reinterpret_cast<T*>(storage_m.begin()));
+    }
+
+    const T* data() const {
+        return std::launder(reinterpret_cast<const T*>(storage_m.cbegin()));
+    }
+
+    void assign_from(const T* source, size_t count) {
+        size_t common = std::min(size_m, count);
+        std::copy(source, source + common, begin());
+        if (count > size_m) {
+            std::uninitialized_copy(source + common, source + count, end());
+        } else {
+            std::destroy(begin() + common, end());
+        }
+        size_m = count;
+    }
+
+    my_array<slot, N> storage_m;
+    size_t size_m;
+};
+
+#endif //MY_VECTOR_MY_INPLACE_VECTOR_HPP
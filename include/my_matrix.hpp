@@ -0,0 +1,473 @@
+#ifndef MY_VECTOR_MY_MATRIX_HPP
+#define MY_VECTOR_MY_MATRIX_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include "my_array.hpp"
+#include "my_span.hpp"
+#include "my_vector.hpp"
+
+// Dense 2-D and N-D containers with all elements in one buffer, instead of
+// a my_vector of row vectors:
+//   my_matrix_view   - non-owning 2-D view with arbitrary row/column strides
+//                      (transposes, sub-blocks, every k-th row) without copies
+//   my_ndarray       - shape fixed at compile time, stored in a my_array
+//   my_matrix        - shape chosen at run time, stored in a single my_vector,
+//                      either row-major or tiled in Tile x Tile blocks so that
+//                      neighbouring rows and columns share cache lines
+// my_blocked_copy and my_blocked_transpose walk matrices block by block so
+// that strided reads and writes stay within cache.
+
+template<typename T>
+class my_matrix_view {
+public:
+    my_matrix_view() : data_m(nullptr), rows_m(0), cols_m(0), row_stride_m(0), col_stride_m(0) {}
+
+    my_matrix_view(T* data, size_t rows, size_t cols, size_t row_stride, size_t col_stride = 1) :
+            data_m(data), rows_m(rows), cols_m(cols), row_stride_m(row_stride), col_stride_m(col_stride) {}
+
+    // a view of T converts to a view of const T
+    template<typename U> requires std::is_convertible_v<U(*)[], T(*)[]>
+    my_matrix_view(const my_matrix_view<U> &other) :
+            my_matrix_view(other.data(), other.rows(), other.cols(), other.row_stride(), other.col_stride()) {}
+
+    T& operator()(size_t row, size_t col) const {
+        return data_m[row * row_stride_m + col * col_stride_m];
+    }
+
+    T& at(size_t row, size_t col) const {
+        if (row >= rows_m || col >= cols_m) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return (*this)(row, col);
+    }
+
+    [[nodiscard]] T* data() const {
+        return data_m;
+    }
+
+    [[nodiscard]] size_t rows() const {
+        return rows_m;
+    }
+
+    [[nodiscard]] size_t cols() const {
+        return cols_m;
+    }
+
+    [[nodiscard]] size_t row_stride() const {
+        return row_stride_m;
+    }
+
+    [[nodiscard]] size_t col_stride() const {
+        return col_stride_m;
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return rows_m == 0 || cols_m == 0;
+    }
+
+    my_matrix_view transposed() const {
+        return my_matrix_view(data_m, cols_m, rows_m, col_stride_m, row_stride_m);
+    }
+
+    my_matrix_view block(size_t row, size_t col, size_t rows, size_t cols) const {
+        if (row + rows > rows_m || col + cols > cols_m) {
+            throw std::out_of_range("The block is out of range!");
+        }
+        return my_matrix_view(data_m + row * row_stride_m + col * col_stride_m,
+                              rows, cols, row_stride_m, col_stride_m);
+    }
+
+    my_matrix_view row(size_t index) const {
+        return block(index, 0, 1, cols_m);
+    }
+
+    my_matrix_view column(size_t index) const {
+        return block(0, index, rows_m, 1);
+    }
+
+    // Every row_step-th row and col_step-th column, starting at (0, 0).
+    my_matrix_view strided(size_t row_step, size_t col_step) const {
+        if (row_step == 0 || col_step == 0) {
+            throw std::invalid_argument("The step must be positive!");
+        }
+        return my_matrix_view(data_m, (rows_m + row_step - 1) / row_step, (cols_m + col_step - 1) / col_step,
+                              row_stride_m * row_step, col_stride_m * col_step);
+    }
+
+private:
+    T* data_m;
+    size_t rows_m;
+    size_t cols_m;
+    size_t row_stride_m;
+    size_t col_stride_m;
+};
+
+template<typename S, typename D> requires std::is_assignable_v<D&, const S&>
+void my_blocked_copy(my_matrix_view<S> src, my_matrix_view<D> dst, size_t block = 32) {
+    if (src.rows() != dst.rows() || src.cols() != dst.cols()) {
+        throw std::invalid_argument("The view shapes do not match!");
+    }
+    if (src.is_empty()) {
+        return;
+    }
+    if (src.col_stride() == 1 && dst.col_stride() == 1) {
+        for (size_t r = 0; r < src.rows(); ++r) {
+            std::copy(&src(r, 0), &src(r, 0) + src.cols(), &dst(r, 0));
+        }
+        return;
+    }
+    block = std::max<size_t>(block, 1);
+    for (size_t r0 = 0; r0 < src.rows(); r0 += block) {
+        size_t r1 = std::min(r0 + block, src.rows());
+        for (size_t c0 = 0; c0 < src.cols(); c0 += block) {
+            size_t c1 = std::min(c0 + block, src.cols());
+            for (size_t r = r0; r < r1; ++r) {
+                for (size_t c = c0; c < c1; ++c) {
+                    dst(r, c) = src(r, c);
+                }
+            }
+        }
+    }
+}
+
+// dst = transpose(src); dst must have src.cols() rows and src.rows() columns.
+template<typename S, typename D> requires std::is_assignable_v<D&, const S&>
+void my_blocked_transpose(my_matrix_view<S> src, my_matrix_view<D> dst, size_t block = 32) {
+    my_blocked_copy(src.transposed(), dst, block);
+}
+
+
+template<typename T, size_t... Dims>
+class my_ndarray {
+    static_assert(sizeof...(Dims) > 0 && ((Dims > 0) && ...), "every extent must be positive");
+
+public:
+    static constexpr size_t rank = sizeof...(Dims);
+    static constexpr size_t total = (Dims * ...);
+
+    my_ndarray() = default;
+
+    explicit my_ndarray(const T &value) : data_m(value) {}
+
+    // Row-major values; missing ones are value-initialized.
+    my_ndarray(const std::initializer_list<T> &list) {
+        if (list.size() > total) {
+            throw std::invalid_argument("Too many values for the shape!");
+        }
+        data_m.fill(T());
+        std::copy(list.begin(), list.end(), data_m.begin());
+    }
+
+    [[nodiscard]] static constexpr size_t extent(size_t dim) {
+        constexpr size_t dims[] = {Dims...};
+        return dims[dim];
+    }
+
+    // Elements between consecutive indices along dim.
+    [[nodiscard]] static constexpr size_t stride(size_t dim) {
+        size_t result = 1;
+        for (size_t d = dim + 1; d < rank; ++d) {
+            result *= extent(d);
+        }
+        return result;
+    }
+
+    [[nodiscard]] static constexpr size_t size() {
+        return total;
+    }
+
+    template<std::convertible_to<size_t>... Idx> requires (sizeof...(Idx) == rank)
+    static constexpr size_t offset(Idx... idx) {
+        size_t result = 0;
+        ((result = result * Dims + static_cast<size_t>(idx)), ...);
+        return result;
+    }
+
+    template<std::convertible_to<size_t>... Idx> requires (sizeof...(Idx) == rank)
+    T& operator()(Idx... idx) {
+        return data_m[offset(idx...)];
+    }
+
+    template<std::convertible_to<size_t>... Idx> requires (sizeof...(Idx) == rank)
+    const T& operator()(Idx... idx) const {
+        return data_m[offset(idx...)];
+    }
+
+    template<std::convertible_to<size_t>... Idx> requires (sizeof...(Idx) == rank)
+    T& at(Idx... idx) {
+        check_indices(idx...);
+        return data_m[offset(idx...)];
+    }
+
+    template<std::convertible_to<size_t>... Idx> requires (sizeof...(Idx) == rank)
+    const T& at(Idx... idx) const {
+        check_indices(idx...);
+        return data_m[offset(idx...)];
+    }
+
+    // flat, row-major access
+    T& operator[](size_t index) noexcept {
+        return data_m[index];
+    }
+
+    const T& operator[](size_t index) const noexcept {
+        return data_m[index];
+    }
+
+    void fill(const T &value) {
+        data_m.fill(value);
+    }
+
+    my_span<T> flat() {
+        return my_span<T>(data_m.begin(), total);
+    }
+
+    my_span<const T> flat() const {
+        return my_span<const T>(data_m.cbegin(), total);
+    }
+
+    my_matrix_view<T> view() requires (rank == 2) {
+        return my_matrix_view<T>(data_m.begin(), extent(0), extent(1), extent(1));
+    }
+
+    my_matrix_view<const T> view() const requires (rank == 2) {
+        return my_matrix_view<const T>(data_m.cbegin(), extent(0), extent(1), extent(1));
+    }
+
+    T* begin() {
+        return data_m.begin();
+    }
+
+    const T* cbegin() const {
+        return data_m.cbegin();
+    }
+
+    T* end() {
+        return data_m.end();
+    }
+
+    const T* cend() const {
+        return data_m.cend();
+    }
+
+    friend bool operator==(const my_ndarray &lhs, const my_ndarray &rhs) {
+        return lhs.data_m == rhs.data_m;
+    }
+
+    friend bool operator!=(const my_ndarray &lhs, const my_ndarray &rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    template<typename... Idx>
+    static void check_indices(Idx... idx) {
+        if (((static_cast<size_t>(idx) >= Dims) || ...)) {
+            throw std::out_of_range("The index is out of range!");
+        }
+    }
+
+    my_array<T, total> data_m;
+};
+
+
+enum class my_matrix_layout {
+    row_major,
+    // Tile x Tile blocks stored one after another in row-major block order,
+    // each block itself row-major; the shape is padded to whole tiles
+    tiled
+};
+
+template<typename T, my_matrix_layout Layout = my_matrix_layout::row_major, size_t Tile = 16>
+class my_matrix {
+    static_assert(std::has_single_bit(Tile), "the tile size must be a power of two");
+
+public:
+    static constexpr my_matrix_layout layout = Layout;
+    static constexpr size_t tile = Tile;
+
+    my_matrix() : rows_m(0), cols_m(0) {};
+
+    my_matrix(size_t rows, size_t cols, const T &value = T()) : rows_m(rows), cols_m(cols) {
+        storage_m.resize_with(padded(rows) * padded(cols), [&value](T* first, size_t count) {
+            std::fill_n(first, count, value);
+        });
+    }
+
+    // Row-major values, rows * cols of them. A braced argument always picks
+    // this constructor over the fill one, so a single value, as in
+    // my_matrix(rows, cols, {v}), fills the whole matrix instead.
+    my_matrix(size_t rows, size_t cols, const std::initializer_list<T> &values) : my_matrix(rows, cols) {
+        if (values.size() == 1) {
+            fill(*values.begin());
+            return;
+        }
+        if (values.size() != rows * cols) {
+            throw std::invalid_argument("The number of values does not match the shape!");
+        }
+        const T* value = values.begin();
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t c = 0; c < cols; ++c) {
+                (*this)(r, c) = *value++;
+            }
+        }
+    }
+
+    // Converts from another layout, walking both block by block.
+    template<my_matrix_layout OtherLayout, size_t OtherTile>
+    explicit my_matrix(const my_matrix<T, OtherLayout, OtherTile> &other) : my_matrix(other.rows(), other.cols()) {
+        constexpr size_t block = std::max(Tile, OtherTile);
+        for (size_t r0 = 0; r0 < rows_m; r0 += block) {
+            for (size_t c0 = 0; c0 < cols_m; c0 += block) {
+                for (size_t r = r0; r < std::min(r0 + block, rows_m); ++r) {
+                    for (size_t c = c0; c < std::min(c0 + block, cols_m); ++c) {
+                        (*this)(r, c) = other(r, c);
+                    }
+                }
+            }
+        }
+    }
+
+    T& operator()(size_t row, size_t col) {
+        return storage_m[offset(row, col)];
+    }
+
+    const T& operator()(size_t row, size_t col) const {
+        return storage_m[offset(row, col)];
+    }
+
+    T& at(size_t row, size_t col) {
+        check_index(row, col);
+        return storage_m[offset(row, col)];
+    }
+
+    const T& at(size_t row, size_t col) const {
+        check_index(row, col);
+        return storage_m[offset(row, col)];
+    }
+
+    [[nodiscard]] size_t rows() const {
+        return rows_m;
+    }
+
+    [[nodiscard]] size_t cols() const {
+        return cols_m;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return rows_m * cols_m;
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return size() == 0;
+    }
+
+    void fill(const T &value) {
+        std::fill(storage_m.begin(), storage_m.end(), value);
+    }
+
+    // The whole buffer; for the tiled layout it includes the padding.
+    my_span<T> storage() {
+        return my_span<T>(storage_m);
+    }
+
+    my_span<const T> storage() const {
+        return my_span<const T>(storage_m);
+    }
+
+    my_matrix_view<T> view() requires (Layout == my_matrix_layout::row_major) {
+        return my_matrix_view<T>(storage_m.begin(), rows_m, cols_m, cols_m);
+    }
+
+    my_matrix_view<const T> view() const requires (Layout == my_matrix_layout::row_major) {
+        return my_matrix_view<const T>(storage_m.cbegin(), rows_m, cols_m, cols_m);
+    }
+
+    my_span<T> row(size_t index) requires (Layout == my_matrix_layout::row_major) {
+        return my_span<T>(storage_m.begin() + index * cols_m, cols_m);
+    }
+
+    my_span<const T> row(size_t index) const requires (Layout == my_matrix_layout::row_major) {
+        return my_span<const T>(storage_m.cbegin() + index * cols_m, cols_m);
+    }
+
+    // Row-major matrices go through my_blocked_transpose; tiled ones
+    // transpose each tile into its mirrored position, so every read and
+    // write stays inside one Tile x Tile block.
+    my_matrix transposed() const {
+        my_matrix result(cols_m, rows_m);
+        if constexpr (Layout == my_matrix_layout::row_major) {
+            my_blocked_transpose(view(), result.view());
+        } else {
+            size_t tile_rows = padded(rows_m) / Tile;
+            size_t tile_cols = padded(cols_m) / Tile;
+            for (size_t ti = 0; ti < tile_rows; ++ti) {
+                for (size_t tj = 0; tj < tile_cols; ++tj) {
+                    const T* from = storage_m.cbegin() + (ti * tile_cols + tj) * Tile * Tile;
+                    T* to = result.storage_m.begin() + (tj * tile_rows + ti) * Tile * Tile;
+                    for (size_t a = 0; a < Tile; ++a) {
+                        for (size_t b = 0; b < Tile; ++b) {
+                            to[b * Tile + a] = from[a * Tile + b];
+                        }
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    friend bool operator==(const my_matrix &lhs, const my_matrix &rhs) {
+        if (lhs.rows_m != rhs.rows_m || lhs.cols_m != rhs.cols_m) {
+            return false;
+        }
+        if constexpr (Layout == my_matrix_layout::row_major) {
+            return lhs.storage_m == rhs.storage_m;
+        } else {
+            for (size_t r = 0; r < lhs.rows_m; ++r) {
+                for (size_t c = 0; c < lhs.cols_m; ++c) {
+                    if (lhs(r, c) != rhs(r, c)) return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    friend bool operator!=(const my_matrix &lhs, const my_matrix &rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    static size_t padded(size_t extent) {
+        if constexpr (Layout == my_matrix_layout::tiled) {
+            return (extent + Tile - 1) / Tile * Tile;
+        } else {
+            return extent;
+        }
+    }
+
+    [[nodiscard]] size_t offset(size_t row, size_t col) const {
+        if constexpr (Layout == my_matrix_layout::tiled) {
+            size_t tile_cols = padded(cols_m) / Tile;
+            return ((row / Tile) * tile_cols + col / Tile) * Tile * Tile + (row % Tile) * Tile + col % Tile;
+        } else {
+            return row * cols_m + col;
+        }
+    }
+
+    void check_index(size_t row, size_t col) const {
+        if (row >= rows_m || col >= cols_m) {
+            throw std::out_of_range("The index is out of range!");
+        }
+    }
+
+    size_t rows_m;
+    size_t cols_m;
+    my_vector<T> storage_m;
+};
+
+#endif //MY_VECTOR_MY_MATRIX_HPP
@@ -0,0 +1,293 @@
+#ifndef MY_VECTOR_MY_NUMA_HPP
+#define MY_VECTOR_MY_NUMA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "my_vector.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// NUMA placement for large my_vector buffers, without a libnuma dependency:
+// topology comes from /sys/devices/system/node, memory policy and page
+// placement from the mbind and move_pages system calls. On other systems, or
+// when the calls are not permitted, everything degrades to a single node.
+
+enum class my_numa_policy {
+    // each node's threads initialize a contiguous slice, so its pages are
+    // faulted in (first touched) on that node
+    first_touch,
+    // pages are spread round-robin over all nodes with mbind
+    interleave
+};
+
+struct my_numa_options {
+    my_numa_policy policy = my_numa_policy::first_touch;
+    // initializing threads per node; 0 starts one per cpu of each node
+    // (all cpus of the machine when the node cpu lists are unavailable)
+    size_t threads_per_node = 0;
+    // fewer threads are started than would leave any of them with less
+    // than this (and never less than a page) to initialize
+    size_t min_bytes_per_thread = size_t(1) << 20;
+};
+
+struct my_numa_placement {
+    // pages_per_node[i] is the number of pages resident on node i
+    my_vector<size_t> pages_per_node;
+    // pages not faulted in yet or whose node could not be queried
+    size_t unknown_pages = 0;
+};
+
+// Parses a sysfs cpu/node list such as "0-3,8,10-11".
+inline my_vector<int> my_numa_parse_list(const std::string &text) {
+    my_vector<int> result;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t comma = text.find(',', pos);
+        std::string part = text.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+        size_t dash = part.find('-');
+        if (!part.empty() && part[0] >= '0' && part[0] <= '9') {
+            int low = std::stoi(part);
+            int high = dash == std::string::npos ? low : std::stoi(part.substr(dash + 1));
+            for (int i = low; i <= high; ++i) {
+                result.push_back(i);
+            }
+        }
+        if (comma == std::string::npos) {
+            break;
+        }
+        pos = comma + 1;
+    }
+    return result;
+}
+
+class my_numa_topology {
+public:
+    my_numa_topology() {
+        std::ifstream online("/sys/devices/system/node/online");
+        std::string text;
+        if (online && std::getline(online, text)) {
+            nodes_m = my_numa_parse_list(text);
+        }
+        if (nodes_m.is_empty()) {
+            nodes_m.push_back(0);
+        }
+        cpus_m.resize(nodes_m.size());
+        for (size_t i = 0; i < nodes_m.size(); ++i) {
+            std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(nodes_m[i]) + "/cpulist");
+            if (cpulist && std::getline(cpulist, text)) {
+                cpus_m[i] = my_numa_parse_list(text);
+            }
+        }
+    }
+
+    [[nodiscard]] size_t node_count() const {
+        return nodes_m.size();
+    }
+
+    // system id of the i-th online node
+    [[nodiscard]] int node_id(size_t index) const {
+        return nodes_m[index];
+    }
+
+    const my_vector<int>& cpus(size_t index) const {
+        return cpus_m[index];
+    }
+
+private:
+    my_vector<int> nodes_m;
+    my_vector<my_vector<int>> cpus_m;
+};
+
+#ifdef __linux__
+inline constexpr int my_numa_mpol_interleave = 3;
+
+inline size_t my_numa_page_size() {
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+// Applies MPOL_INTERLEAVE over all nodes to the whole pages inside
+// [first, first + bytes). Must run before the pages are touched.
+inline bool my_numa_interleave(void* first, size_t bytes, const my_numa_topology &topology) {
+    if (topology.node_count() < 2) {
+        return false;
+    }
+    size_t page = my_numa_page_size();
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(first) + page - 1) / page * page;
+    uintptr_t end = (reinterpret_cast<uintptr_t>(first) + bytes) / page * page;
+    if (end <= begin) {
+        return false;
+    }
+    constexpr size_t mask_bits = 1024;
+    unsigned long mask[mask_bits / (8 * sizeof(unsigned long))] = {};
+    for (size_t i = 0; i < topology.node_count(); ++i) {
+        size_t node = topology.node_id(i);
+        if (node < mask_bits) {
+            mask[node / (8 * sizeof(unsigned long))] |= 1ul << (node % (8 * sizeof(unsigned long)));
+        }
+    }
+    return syscall(SYS_mbind, begin, end - begin, my_numa_mpol_interleave, mask, mask_bits + 1, 0) == 0;
+}
+
+// Restricts the calling thread to the given cpus.
+inline void my_numa_pin_current_thread(const my_vector<int> &cpus) {
+    if (cpus.is_empty()) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (size_t i = 0; i < cpus.size(); ++i) {
+        CPU_SET(cpus[i], &set);
+    }
+    sched_setaffinity(0, sizeof(set), &set);
+}
+#endif
+
+// Node index of every initializing thread the options ask for, grouped by
+// node in order.
+inline my_vector<size_t> my_numa_thread_nodes(const my_numa_topology &topology, const my_numa_options &options) {
+    my_vector<size_t> result;
+    for (size_t node = 0; node < topology.node_count(); ++node) {
+        size_t threads = options.threads_per_node != 0 ? options.threads_per_node : topology.cpus(node).size();
+        for (size_t i = 0; i < threads; ++i) {
+            result.push_back(node);
+        }
+    }
+    if (result.is_empty()) {
+        result.resize(std::max(1u, std::thread::hardware_concurrency()), 0);
+    }
+    return result;
+}
+
+// How many of the available threads to start for initializing bytes: each
+// gets at least min_bytes_per_thread, and at least a page.
+inline size_t my_numa_thread_count(size_t bytes, size_t available, const my_numa_options &options) {
+#ifdef __linux__
+    size_t page = my_numa_page_size();
+#else
+    size_t page = 4096;
+#endif
+    size_t slice = std::max(options.min_bytes_per_thread, page);
+    return std::max<size_t>(1, std::min(available, bytes / slice));
+}
+
+// Fills [first, first + count) with value on parallel threads laid out as
+// the options ask: per node, pinned to that node's cpus, for first_touch;
+// after an interleave mbind for interleave. Small ranges are filled on the
+// calling thread. Reading the topology goes to sysfs, so callers filling
+// often should keep one my_numa_topology and pass it in.
+template<typename T>
+void my_numa_fill(T* first, size_t count, const T &value, const my_numa_topology &topology,
+                  const my_numa_options &options = my_numa_options()) {
+    size_t nodes = topology.node_count();
+#ifdef __linux__
+    if (options.policy == my_numa_policy::interleave) {
+        my_numa_interleave(first, count * sizeof(T), topology);
+    }
+#endif
+    my_vector<size_t> thread_nodes = my_numa_thread_nodes(topology, options);
+    size_t threads = my_numa_thread_count(count * sizeof(T), thread_nodes.size(), options);
+    if (threads == 1) {
+        std::fill_n(first, count, value);
+        return;
+    }
+    my_vector<std::thread> workers;
+    workers.reserve(threads);
+    bool pin = options.policy == my_numa_policy::first_touch && nodes > 1;
+    for (size_t i = 0; i < threads; ++i) {
+        T* slice_begin = first + count * i / threads;
+        T* slice_end = first + count * (i + 1) / threads;
+        // thread i gets slice i, so the slices are grouped by node in order
+        const my_vector<int>* cpus = &topology.cpus(thread_nodes[i * thread_nodes.size() / threads]);
+        workers.emplace_back(std::thread([slice_begin, slice_end, cpus, pin, &value]() {
+#ifdef __linux__
+            if (pin) {
+                my_numa_pin_current_thread(*cpus);
+            }
+#else
+            (void) cpus;
+            (void) pin;
+#endif
+            std::fill(slice_begin, slice_end, value);
+        }));
+    }
+    for (size_t i = 0; i < workers.size(); ++i) {
+        workers[i].join();
+    }
+}
+
+template<typename T>
+void my_numa_fill(T* first, size_t count, const T &value, const my_numa_options &options = my_numa_options()) {
+    my_numa_fill(first, count, value, my_numa_topology(), options);
+}
+
+// resize() that initializes the new tail with my_numa_fill. First-touch
+// placement needs T to be trivially default constructible; other types are
+// already constructed (and touched) by the allocation.
+template<typename T>
+void my_numa_resize(my_vector<T> &vec, size_t n, const T &value, const my_numa_topology &topology,
+                    const my_numa_options &options = my_numa_options()) {
+    vec.resize_with(n, [&value, &topology, &options](T* first, size_t count) {
+        my_numa_fill(first, count, value, topology, options);
+    });
+}
+
+template<typename T>
+void my_numa_resize(my_vector<T> &vec, size_t n, const T &value, const my_numa_options &options = my_numa_options()) {
+    my_numa_resize(vec, n, value, my_numa_topology(), options);
+}
+
+// Reports on which node each page of [data, data + bytes) currently lives.
+inline my_numa_placement my_numa_page_placement(const void* data, size_t bytes) {
+    my_numa_topology topology;
+    my_numa_placement result;
+    int max_node = 0;
+    for (size_t i = 0; i < topology.node_count(); ++i) {
+        max_node = std::max(max_node, topology.node_id(i));
+    }
+    result.pages_per_node.resize(max_node + 1, 0);
+#ifdef __linux__
+    size_t page = my_numa_page_size();
+    uintptr_t begin = reinterpret_cast<uintptr_t>(data) / page * page;
+    uintptr_t end = reinterpret_cast<uintptr_t>(data) + bytes;
+    constexpr size_t batch = 1024;
+    void* pages[batch];
+    int status[batch];
+    for (uintptr_t address = begin; address < end;) {
+        size_t count = 0;
+        for (; count < batch && address < end; ++count, address += page) {
+            pages[count] = reinterpret_cast<void*>(address);
+        }
+        if (syscall(SYS_move_pages, 0, count, pages, nullptr, status, 0) != 0) {
+            result.unknown_pages += count;
+            continue;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (status[i] >= 0 && static_cast<size_t>(status[i]) < result.pages_per_node.size()) {
+                ++result.pages_per_node[status[i]];
+            } else {
+                ++result.unknown_pages;
+            }
+        }
+    }
+#else
+    (void) data;
+    result.unknown_pages = bytes == 0 ? 0 : 1;
+#endif
+    return result;
+}
+
+template<typename T>
+my_numa_placement my_numa_page_placement(const my_vector<T> &vec) {
+    return my_numa_page_placement(vec.cbegin(), vec.size() * sizeof(T));
+}
+
+#endif //MY_VECTOR_MY_NUMA_HPP
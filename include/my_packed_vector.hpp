@@ -0,0 +1,267 @@
+#ifndef MY_VECTOR_MY_PACKED_VECTOR_HPP
+#define MY_VECTOR_MY_PACKED_VECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "my_simd.hpp"
+#include "my_span.hpp"
+#include "my_vector.hpp"
+
+// Vector of unsigned integers stored with a fixed number of bits per element,
+// either given explicitly or derived from the largest value. Elements are
+// laid out back to back in 64-bit words; one extra zero word at the end lets
+// every element be read with a single unaligned 8-byte load.
+template<typename UInt>
+class my_packed_vector {
+    static_assert(std::is_unsigned_v<UInt>, "my_packed_vector stores unsigned integers only");
+
+public:
+    static constexpr unsigned max_width = std::numeric_limits<UInt>::digits;
+
+    my_packed_vector() : my_packed_vector(max_width) {};
+
+    explicit my_packed_vector(unsigned bit_width) : size_m(0), width_m(bit_width) {
+        if (bit_width == 0 || bit_width > max_width) {
+            throw std::invalid_argument("The bit width is out of range!");
+        }
+        words_m.resize(1, 0);
+    }
+
+    my_packed_vector(unsigned bit_width, my_span<const UInt> values) : my_packed_vector(bit_width) {
+        reserve(values.size());
+        for (UInt value : values) {
+            push_back(value);
+        }
+    }
+
+    // picks the smallest width that fits the largest value
+    explicit my_packed_vector(my_span<const UInt> values)
+            : my_packed_vector(required_width(values), values) {}
+
+    static unsigned required_width(my_span<const UInt> values) {
+        UInt max_value = 0;
+        for (UInt value : values) {
+            max_value |= value;
+        }
+        return max_value == 0 ? 1 : std::bit_width(max_value);
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return size_m == 0;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return size_m;
+    }
+
+    [[nodiscard]] unsigned bit_width() const {
+        return width_m;
+    }
+
+    [[nodiscard]] size_t size_bytes() const {
+        return words_m.size() * sizeof(uint64_t);
+    }
+
+    void reserve(size_t value) {
+        words_m.reserve(words_for(value));
+    }
+
+    void clear() {
+        words_m.resize(1, 0);
+        words_m[0] = 0;
+        size_m = 0;
+    }
+
+    UInt operator[](size_t index) const {
+        return static_cast<UInt>(load(index));
+    }
+
+    UInt at(size_t index) const {
+        if (index >= size_m) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return (*this)[index];
+    }
+
+    UInt front() const {
+        return (*this)[0];
+    }
+
+    UInt back() const {
+        return (*this)[size_m - 1];
+    }
+
+    void set(size_t index, UInt value) {
+        if (index >= size_m) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        check_fits(value);
+        store(index, value);
+    }
+
+    void push_back(UInt value) {
+        check_fits(value);
+        size_t needed = words_for(size_m + 1);
+        if (needed > words_m.size()) {
+            words_m.resize(needed, 0);
+        }
+        store(size_m, value);
+        ++size_m;
+    }
+
+    void pop_back() {
+        store(size_m - 1, 0);
+        --size_m;
+    }
+
+    // Unpacks count elements starting at first into out. The AVX2 path is
+    // picked at run time; level can force a lower one, a higher one than
+    // the CPU supports is ignored.
+    void decode(size_t first, my_span<UInt> out, my_simd_level level = my_detect_simd_level()) const {
+        size_t count = out.size();
+        if (first > size_m || count > size_m - first) {
+            throw std::out_of_range("The range is out of range!");
+        }
+        UInt* target = out.data();
+        size_t i = 0;
+#ifdef MY_SIMD_X86
+        if (std::min(level, my_detect_simd_level()) >= my_simd_level::avx2) {
+            i = decode_avx2(first, target, count);
+        }
+#else
+        (void) level;
+#endif
+        if constexpr (std::endian::native == std::endian::little) {
+            if (width_m <= 57) {
+                const auto* bytes = reinterpret_cast<const unsigned char*>(words_m.cbegin());
+                uint64_t mask = low_mask(width_m);
+                for (; i < count; ++i) {
+                    size_t offset = (first + i) * width_m;
+                    uint64_t chunk;
+                    std::memcpy(&chunk, bytes + offset / 8, sizeof(chunk));
+                    target[i] = static_cast<UInt>((chunk >> (offset % 8)) & mask);
+                }
+                return;
+            }
+        }
+        for (; i < count; ++i) {
+            target[i] = static_cast<UInt>(load(first + i));
+        }
+    }
+
+    my_vector<UInt> to_vector() const {
+        my_vector<UInt> result;
+        result.resize(size_m);
+        decode(0, my_span<UInt>(result));
+        return result;
+    }
+
+    const my_vector<uint64_t>& words() const {
+        return words_m;
+    }
+
+    friend bool operator==(const my_packed_vector &lhs, const my_packed_vector &rhs) {
+        if (lhs.size_m != rhs.size_m) return false;
+        for (size_t i = 0; i < lhs.size_m; ++i) {
+            if (lhs[i] != rhs[i]) return false;
+        }
+        return true;
+    }
+
+    friend bool operator!=(const my_packed_vector &lhs, const my_packed_vector &rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    static uint64_t low_mask(unsigned bits) {
+        return bits >= 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+    }
+
+    // data words plus the trailing padding word
+    size_t words_for(size_t count) const {
+        return (count * width_m + 63) / 64 + 1;
+    }
+
+    void check_fits(UInt value) const {
+        if (width_m < 64 && static_cast<uint64_t>(value) > low_mask(width_m)) {
+            throw std::invalid_argument("The value does not fit in the bit width!");
+        }
+    }
+
+    uint64_t load(size_t index) const {
+        size_t offset = index * width_m;
+        size_t word = offset / 64;
+        unsigned shift = offset % 64;
+        uint64_t value = words_m[word] >> shift;
+        if (shift + width_m > 64) {
+            value |= words_m[word + 1] << (64 - shift);
+        }
+        return value & low_mask(width_m);
+    }
+
+    void store(size_t index, uint64_t value) {
+        size_t offset = index * width_m;
+        size_t word = offset / 64;
+        unsigned shift = offset % 64;
+        uint64_t mask = low_mask(width_m);
+        words_m[word] = (words_m[word] & ~(mask << shift)) | (value << shift);
+        if (shift + width_m > 64) {
+            unsigned spilled = 64 - shift;
+            words_m[word + 1] = (words_m[word + 1] & ~(mask >> spilled)) | (value >> spilled);
+        }
+    }
+
+#ifdef MY_SIMD_X86
+    // Eight elements per step: gather 32 bits starting at each element's
+    // byte offset, shift each lane by its bit offset and mask. Works while
+    // width + 7 fits in a 32-bit lane. The lane offsets are relative to the
+    // byte holding the block's first element, so they stay below 8 * width
+    // however large the vector is. Returns how many elements were done.
+    __attribute__((target("avx2")))
+    size_t decode_avx2(size_t first, UInt* target, size_t count) const {
+        if constexpr (sizeof(UInt) != 4 && sizeof(UInt) != 8) {
+            return 0;
+        } else {
+            if (width_m > 25) {
+                return 0;
+            }
+            const auto* bytes = reinterpret_cast<const unsigned char*>(words_m.cbegin());
+            const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            const __m256i width = _mm256_set1_epi32(static_cast<int>(width_m));
+            const __m256i seven = _mm256_set1_epi32(7);
+            const __m256i mask = _mm256_set1_epi32(static_cast<int>(low_mask(width_m)));
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                size_t bit = (first + i) * width_m;
+                const auto* block = reinterpret_cast<const int*>(bytes + bit / 8);
+                __m256i base = _mm256_set1_epi32(static_cast<int>(bit % 8));
+                __m256i offsets = _mm256_add_epi32(base, _mm256_mullo_epi32(lanes, width));
+                __m256i chunks = _mm256_i32gather_epi32(block, _mm256_srli_epi32(offsets, 3), 1);
+                __m256i values = _mm256_and_si256(
+                        _mm256_srlv_epi32(chunks, _mm256_and_si256(offsets, seven)), mask);
+                if constexpr (sizeof(UInt) == 4) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i), values);
+                } else {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i),
+                                        _mm256_cvtepu32_epi64(_mm256_castsi256_si128(values)));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i + 4),
+                                        _mm256_cvtepu32_epi64(_mm256_extracti128_si256(values, 1)));
+                }
+            }
+            return i;
+        }
+    }
+#endif
+
+    my_vector<uint64_t> words_m;
+    size_t size_m;
+    unsigned width_m;
+};
+
+#endif //MY_VECTOR_MY_PACKED_VECTOR_HPP
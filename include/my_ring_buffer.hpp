@@ -0,0 +1,276 @@
+#ifndef MY_VECTOR_MY_RING_BUFFER_HPP
+#define MY_VECTOR_MY_RING_BUFFER_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+#include "my_array.hpp"
+#include "my_span.hpp"
+
+// Fixed-capacity FIFO over my_array storage. N must be a power of two so the
+// position of an element is its running index masked with N - 1; head and
+// tail only ever grow and their difference is the size.
+template<typename T, size_t N>
+class my_ring_buffer {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Ring buffer capacity must be a power of two");
+
+public:
+    my_ring_buffer() : head_m(0), tail_m(0) {};
+
+    [[nodiscard]] bool is_empty() const {
+        return head_m == tail_m;
+    }
+
+    [[nodiscard]] bool is_full() const {
+        return tail_m - head_m == N;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return tail_m - head_m;
+    }
+
+    [[nodiscard]] static constexpr size_t capacity() {
+        return N;
+    }
+
+    // element at logical position index, 0 being the oldest one
+    T& operator[](size_t index) {
+        return data[(head_m + index) & mask];
+    }
+
+    const T& operator[](size_t index) const {
+        return data[(head_m + index) & mask];
+    }
+
+    T& at(size_t index) {
+        if (index >= size()) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return (*this)[index];
+    }
+
+    const T& at(size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return (*this)[index];
+    }
+
+    T& front() {
+        return data[head_m & mask];
+    }
+
+    const T& front() const {
+        return data[head_m & mask];
+    }
+
+    T& back() {
+        return data[(tail_m - 1) & mask];
+    }
+
+    const T& back() const {
+        return data[(tail_m - 1) & mask];
+    }
+
+    bool push(const T &value) {
+        if (is_full()) {
+            return false;
+        }
+        data[tail_m & mask] = value;
+        ++tail_m;
+        return true;
+    }
+
+    bool push(T &&value) {
+        if (is_full()) {
+            return false;
+        }
+        data[tail_m & mask] = std::move(value);
+        ++tail_m;
+        return true;
+    }
+
+    bool pop(T &out) {
+        if (is_empty()) {
+            return false;
+        }
+        out = std::move(data[head_m & mask]);
+        ++head_m;
+        return true;
+    }
+
+    void pop_front() {
+        ++head_m;
+    }
+
+    // Pushes as many elements of items as fit, in at most two contiguous
+    // copies. Returns how many were pushed.
+    size_t push(my_span<const T> items) {
+        size_t count = std::min(items.size(), N - size());
+        copy_in(tail_m, items.begin(), count);
+        tail_m += count;
+        return count;
+    }
+
+    // Pops up to out.size() elements into out. Returns how many were popped.
+    size_t pop(my_span<T> out) {
+        size_t count = std::min(out.size(), size());
+        copy_out(head_m, out.begin(), count);
+        head_m += count;
+        return count;
+    }
+
+    void clear() {
+        head_m = 0;
+        tail_m = 0;
+    }
+
+private:
+    static constexpr size_t mask = N - 1;
+
+    void copy_in(size_t position, const T* source, size_t count) {
+        size_t start = position & mask;
+        size_t first_part = std::min(count, N - start);
+        std::copy(source, source + first_part, data.begin() + start);
+        std::copy(source + first_part, source + count, data.begin());
+    }
+
+    void copy_out(size_t position, T* target, size_t count) {
+        size_t start = position & mask;
+        size_t first_part = std::min(count, N - start);
+        std::move(data.begin() + start, data.begin() + start + first_part, target);
+        std::move(data.begin(), data.begin() + (count - first_part), target + first_part);
+    }
+
+    my_array<T, N> data;
+    size_t head_m;
+    size_t tail_m;
+};
+
+
+// Lock-free single-producer/single-consumer queue over my_array storage.
+// The producer owns tail_m and the consumer owns head_m; each sits on its own
+// cache line together with the owner's cached copy of the other index, so
+// the hot path touches the shared line only when the cached copy says the
+// queue looks full (producer) or empty (consumer).
+template<typename T, size_t N>
+class my_spsc_queue {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Queue capacity must be a power of two");
+
+public:
+    static constexpr size_t cache_line = 64;
+
+    my_spsc_queue() : head_m(0), cached_tail_m(0), tail_m(0), cached_head_m(0) {};
+
+    my_spsc_queue(const my_spsc_queue &other)=delete;
+    my_spsc_queue &operator=(const my_spsc_queue &other)=delete;
+
+    [[nodiscard]] static constexpr size_t capacity() {
+        return N;
+    }
+
+    // Exact only when called from the producer or the consumer while the
+    // other side is idle; otherwise a snapshot. head is read first, so the
+    // later tail is never behind it; both may move in between, hence the
+    // clamp to the capacity.
+    [[nodiscard]] size_t size() const {
+        size_t head = head_m.load(std::memory_order_acquire);
+        size_t tail = tail_m.load(std::memory_order_acquire);
+        return std::min(tail - head, N);
+    }
+
+    [[nodiscard]] bool is_empty() const {
+        return size() == 0;
+    }
+
+    // producer side
+
+    bool try_push(const T &value) {
+        size_t tail = tail_m.load(std::memory_order_relaxed);
+        if (!has_room(tail, 1)) {
+            return false;
+        }
+        data[tail & mask] = value;
+        tail_m.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(T &&value) {
+        size_t tail = tail_m.load(std::memory_order_relaxed);
+        if (!has_room(tail, 1)) {
+            return false;
+        }
+        data[tail & mask] = std::move(value);
+        tail_m.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pushes as many elements of items as fit. Returns how many were pushed.
+    size_t try_push(my_span<const T> items) {
+        size_t tail = tail_m.load(std::memory_order_relaxed);
+        has_room(tail, items.size());
+        size_t count = std::min(items.size(), N - (tail - cached_head_m));
+        size_t start = tail & mask;
+        size_t first_part = std::min(count, N - start);
+        std::copy(items.begin(), items.begin() + first_part, data.begin() + start);
+        std::copy(items.begin() + first_part, items.begin() + count, data.begin());
+        tail_m.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // consumer side
+
+    bool try_pop(T &out) {
+        size_t head = head_m.load(std::memory_order_relaxed);
+        if (!has_items(head, 1)) {
+            return false;
+        }
+        out = std::move(data[head & mask]);
+        head_m.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pops up to out.size() elements. Returns how many were popped.
+    size_t try_pop(my_span<T> out) {
+        size_t head = head_m.load(std::memory_order_relaxed);
+        has_items(head, out.size());
+        size_t count = std::min(out.size(), cached_tail_m - head);
+        size_t start = head & mask;
+        size_t first_part = std::min(count, N - start);
+        std::move(data.begin() + start, data.begin() + start + first_part, out.begin());
+        std::move(data.begin(), data.begin() + (count - first_part), out.begin() + first_part);
+        head_m.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    static constexpr size_t mask = N - 1;
+
+    bool has_room(size_t tail, size_t count) {
+        if (N - (tail - cached_head_m) >= count) {
+            return true;
+        }
+        cached_head_m = head_m.load(std::memory_order_acquire);
+        return N - (tail - cached_head_m) >= count;
+    }
+
+    bool has_items(size_t head, size_t count) {
+        if (cached_tail_m - head >= count) {
+            return true;
+        }
+        cached_tail_m = tail_m.load(std::memory_order_acquire);
+        return cached_tail_m - head >= count;
+    }
+
+    // consumer cache line
+    alignas(cache_line) std::atomic<size_t> head_m;
+    size_t cached_tail_m;
+    // producer cache line
+    alignas(cache_line) std::atomic<size_t> tail_m;
+    size_t cached_head_m;
+    alignas(cache_line) my_array<T, N> data;
+};
+
+#endif //MY_VECTOR_MY_RING_BUFFER_HPP
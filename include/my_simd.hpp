@@ -0,0 +1,29 @@
+#ifndef MY_VECTOR_MY_SIMD_HPP
+#define MY_VECTOR_MY_SIMD_HPP
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MY_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// Instruction sets the vectorized kernels can use. Kernels are compiled with
+// __attribute__((target(...))) and picked at run time, so the binary still
+// runs on CPUs without them.
+enum class my_simd_level {
+    scalar = 0,
+    avx2 = 1,
+    avx512 = 2
+};
+
+inline my_simd_level my_detect_simd_level() {
+#ifdef MY_SIMD_X86
+    static const my_simd_level level = __builtin_cpu_supports("avx512f") ? my_simd_level::avx512 :
+                                       __builtin_cpu_supports("avx2") ? my_simd_level::avx2 :
+                                       my_simd_level::scalar;
+    return level;
+#else
+    return my_simd_level::scalar;
+#endif
+}
+
+#endif //MY_VECTOR_MY_SIMD_HPP
@@ -0,0 +1,186 @@
+#ifndef MY_VECTOR_MY_SORT_HPP
+#define MY_VECTOR_MY_SORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "my_vector.hpp"
+
+// Keys LSD radix sort can handle: integers, float and double.
+template<typename K>
+concept my_radix_key_type = std::is_integral_v<K> ||
+                            std::is_same_v<K, float> || std::is_same_v<K, double>;
+
+// Maps a key to an unsigned integer with the same ordering: the sign bit of
+// signed integers is flipped, negative floats have all bits flipped and
+// non-negative floats only the sign bit.
+template<my_radix_key_type K>
+auto my_radix_key(K value) {
+    if constexpr (std::is_floating_point_v<K>) {
+        using U = std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>;
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        U bits = std::bit_cast<U>(value);
+        return (bits & sign) ? U(~bits) : U(bits | sign);
+    } else if constexpr (std::is_signed_v<K>) {
+        using U = std::make_unsigned_t<K>;
+        constexpr U sign = U(1) << (sizeof(U) * 8 - 1);
+        return U(U(value) ^ sign);
+    } else {
+        return value;
+    }
+}
+
+struct my_sort_policy {
+    // worker threads used for inputs of at least parallel_threshold elements
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t parallel_threshold = size_t(1) << 20;
+    // below this size a comparison sort beats the radix passes
+    size_t radix_threshold = 256;
+};
+
+// Stable LSD radix sort of [first, last) by key(element), one byte per pass.
+// All histograms are built in a single read of the input, and passes where
+// every key has the same byte are skipped. scratch must hold last - first
+// elements; the result ends up in [first, last).
+template<typename T, typename KeyFn>
+void my_radix_sort(T* first, T* last, T* scratch, KeyFn key) {
+    using key_type = decltype(my_radix_key(key(*first)));
+    constexpr size_t passes = sizeof(key_type);
+    size_t n = last - first;
+    if (n < 2) {
+        return;
+    }
+
+    size_t counts[passes][256] = {};
+    for (T* it = first; it != last; ++it) {
+        key_type k = my_radix_key(key(*it));
+        for (size_t p = 0; p < passes; ++p) {
+            ++counts[p][(k >> (p * 8)) & 0xFF];
+        }
+    }
+
+    T* source = first;
+    T* target = scratch;
+    for (size_t p = 0; p < passes; ++p) {
+        if (counts[p][(my_radix_key(key(*source)) >> (p * 8)) & 0xFF] == n) {
+            continue;
+        }
+        size_t offsets[256];
+        size_t sum = 0;
+        for (size_t d = 0; d < 256; ++d) {
+            offsets[d] = sum;
+            sum += counts[p][d];
+        }
+        for (size_t i = 0; i < n; ++i) {
+            size_t digit = (my_radix_key(key(source[i])) >> (p * 8)) & 0xFF;
+            target[offsets[digit]++] = std::move(source[i]);
+        }
+        std::swap(source, target);
+    }
+    if (source != first) {
+        std::move(source, source + n, first);
+    }
+}
+
+// Sorts equal slices of [first, first + n) on separate threads with
+// sort_chunk(begin, end, scratch), then merges neighbouring runs pairwise,
+// again one thread per merge, ping-ponging between the input and scratch.
+template<typename T, typename ChunkSort, typename Less>
+void my_parallel_sort(T* first, size_t n, T* scratch, size_t threads, ChunkSort sort_chunk, Less less) {
+    threads = std::max<size_t>(1, std::min(threads, n));
+    my_vector<size_t> bounds;
+    bounds.reserve(threads + 1);
+    for (size_t i = 0; i <= threads; ++i) {
+        bounds.push_back(n * i / threads);
+    }
+    const size_t* bound = bounds.cbegin();
+
+    my_vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        workers.emplace_back(std::thread([=]() {
+            sort_chunk(first + bound[i], first + bound[i + 1], scratch + bound[i]);
+        }));
+    }
+    for (size_t i = 0; i < threads; ++i) {
+        workers[i].join();
+    }
+
+    T* source = first;
+    T* target = scratch;
+    for (size_t width = 1; width < threads; width *= 2) {
+        workers.clear();
+        for (size_t i = 0; i < threads; i += 2 * width) {
+            size_t low = bounds[i];
+            size_t middle = bounds[std::min(i + width, threads)];
+            size_t high = bounds[std::min(i + 2 * width, threads)];
+            workers.emplace_back(std::thread([=]() {
+                std::merge(std::make_move_iterator(source + low), std::make_move_iterator(source + middle),
+                           std::make_move_iterator(source + middle), std::make_move_iterator(source + high),
+                           target + low, less);
+            }));
+        }
+        for (size_t i = 0; i < workers.size(); ++i) {
+            workers[i].join();
+        }
+        std::swap(source, target);
+    }
+    if (source != first) {
+        std::move(source, source + n, first);
+    }
+}
+
+// Sorts records by an integral or floating-point key, stably.
+template<typename T, typename KeyFn>
+requires std::invocable<KeyFn, const T&> &&
+         my_radix_key_type<std::remove_cvref_t<std::invoke_result_t<KeyFn, const T&>>>
+void my_sort(my_vector<T> &vec, KeyFn key, const my_sort_policy &policy = my_sort_policy()) {
+    size_t n = vec.size();
+    auto less = [&key](const T &lhs, const T &rhs) {
+        return my_radix_key(key(lhs)) < my_radix_key(key(rhs));
+    };
+    if (n < policy.radix_threshold) {
+        std::stable_sort(vec.begin(), vec.end(), less);
+        return;
+    }
+    // only the buffer is needed: reserve() allocates exactly n slots
+    // without resetting them, and the sort overwrites every one it reads
+    my_vector<T> scratch;
+    scratch.reserve(n);
+    if (n >= policy.parallel_threshold && policy.threads > 1) {
+        my_parallel_sort(vec.begin(), n, scratch.begin(), policy.threads,
+                         [&key](T* first, T* last, T* buffer) { my_radix_sort(first, last, buffer, key); },
+                         less);
+    } else {
+        my_radix_sort(vec.begin(), vec.end(), scratch.begin(), key);
+    }
+}
+
+// Radix sort for integral and floating-point elements, introsort
+// (std::sort) for anything else; large inputs are split across threads.
+template<typename T>
+void my_sort(my_vector<T> &vec, const my_sort_policy &policy = my_sort_policy()) {
+    if constexpr (my_radix_key_type<T>) {
+        my_sort(vec, [](const T &value) { return value; }, policy);
+    } else {
+        size_t n = vec.size();
+        if (n >= policy.parallel_threshold && policy.threads > 1) {
+            my_vector<T> scratch;
+            scratch.reserve(n);
+            my_parallel_sort(vec.begin(), n, scratch.begin(), policy.threads,
+                             [](T* first, T* last, T*) { std::sort(first, last); },
+                             std::less<T>());
+        } else {
+            std::sort(vec.begin(), vec.end());
+        }
+    }
+}
+
+#endif //MY_VECTOR_MY_SORT_HPP
@@ -0,0 +1,209 @@
+#ifndef MY_VECTOR_MY_SPAN_HPP
+#define MY_VECTOR_MY_SPAN_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+template<typename T>
+class my_vector;
+
+template<typename T, size_t N>
+class my_array;
+
+template<typename T>
+class my_compact_vector;
+
+inline constexpr size_t dynamic_extent = std::numeric_limits<size_t>::max();
+
+// Non-owning view over a contiguous range. A span with a static Extent
+// (made from my_array<T, N>) carries its size in the type.
+template<typename T, size_t Extent = dynamic_extent>
+class my_span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+
+    static constexpr size_t extent = Extent;
+
+    constexpr my_span() noexcept requires (Extent == 0 || Extent == dynamic_extent)
+            : data_m(nullptr), size_m(0) {};
+
+    constexpr my_span(T *first, size_t count) : data_m(first), size_m(count) {}
+
+    constexpr my_span(T *first, T *last) : data_m(first), size_m(last - first) {}
+
+    template<size_t N> requires (Extent == dynamic_extent || Extent == N)
+    constexpr my_span(T (&arr)[N]) noexcept : data_m(arr), size_m(N) {}
+
+    my_span(my_vector<value_type> &vec) requires (Extent == dynamic_extent)
+            : data_m(vec.begin()), size_m(vec.size()) {}
+
+    my_span(const my_vector<value_type> &vec) requires (Extent == dynamic_extent && std::is_const_v<T>)
+            : data_m(vec.cbegin()), size_m(vec.size()) {}
+
+    my_span(my_compact_vector<value_type> &vec) requires (Extent == dynamic_extent)
+            : data_m(vec.begin()), size_m(vec.size()) {}
+
+    my_span(const my_compact_vector<value_type> &vec) requires (Extent == dynamic_extent && std::is_const_v<T>)
+            : data_m(vec.cbegin()), size_m(vec.size()) {}
+
+    template<size_t N> requires (Extent == dynamic_extent || Extent == N)
+    my_span(my_array<value_type, N> &arr) : data_m(arr.begin()), size_m(N) {}
+
+    template<size_t N> requires ((Extent == dynamic_extent || Extent == N) && std::is_const_v<T>)
+    my_span(const my_array<value_type, N> &arr) : data_m(arr.cbegin()), size_m(N) {}
+
+    // my_span<int, N> -> my_span<const int> and similar widening conversions
+    template<typename U, size_t N>
+    requires ((Extent == dynamic_extent || Extent == N) && std::is_convertible_v<U(*)[], T(*)[]>)
+    constexpr my_span(const my_span<U, N> &other) noexcept : data_m(other.data()), size_m(other.size()) {}
+
+    constexpr my_span(const my_span &other) noexcept=default;
+    constexpr my_span &operator=(const my_span &other) noexcept=default;
+
+    constexpr T& operator[](size_t index) const {
+        return data_m[index];
+    }
+
+    constexpr T& at(size_t index) const {
+        if (index >= size()) {
+            throw std::out_of_range("The index is out of range!");
+        }
+        return data_m[index];
+    }
+
+    constexpr T& front() const {
+        return data_m[0];
+    }
+
+    constexpr T& back() const {
+        return data_m[size() - 1];
+    }
+
+    constexpr T* data() const noexcept {
+        return data_m;
+    }
+
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        if constexpr (Extent != dynamic_extent) {
+            return Extent;
+        } else {
+            return size_m;
+        }
+    }
+
+    [[nodiscard]] constexpr size_t size_bytes() const noexcept {
+        return size() * sizeof(T);
+    }
+
+    [[nodiscard]] constexpr bool is_empty() const noexcept {
+        return size() == 0;
+    }
+
+    constexpr my_span<T> first(size_t count) const {
+        if (count > size()) {
+            throw std::out_of_range("The count is out of range!");
+        }
+        return my_span<T>(data_m, count);
+    }
+
+    constexpr my_span<T> last(size_t count) const {
+        if (count > size()) {
+            throw std::out_of_range("The count is out of range!");
+        }
+        return my_span<T>(data_m + size() - count, count);
+    }
+
+    constexpr my_span<T> subspan(size_t offset, size_t count = dynamic_extent) const {
+        if (offset > size()) {
+            throw std::out_of_range("The offset is out of range!");
+        }
+        if (count == dynamic_extent) {
+            count = size() - offset;
+        } else if (count > size() - offset) {
+            throw std::out_of_range("The count is out of range!");
+        }
+        return my_span<T>(data_m + offset, count);
+    }
+
+    template<size_t Count>
+    constexpr my_span<T, Count> first() const {
+        static_assert(Extent == dynamic_extent || Count <= Extent, "Count is bigger than the extent");
+        if (Count > size()) {
+            throw std::out_of_range("The count is out of range!");
+        }
+        return my_span<T, Count>(data_m, Count);
+    }
+
+    template<size_t Count>
+    constexpr my_span<T, Count> last() const {
+        static_assert(Extent == dynamic_extent || Count <= Extent, "Count is bigger than the extent");
+        if (Count > size()) {
+            throw std::out_of_range("The count is out of range!");
+        }
+        return my_span<T, Count>(data_m + size() - Count, Count);
+    }
+
+    template<size_t Offset, size_t Count>
+    constexpr my_span<T, Count> subspan() const {
+        static_assert(Extent == dynamic_extent || Offset + Count <= Extent, "Subspan is out of the extent");
+        if (Offset + Count > size()) {
+            throw std::out_of_range("The subspan is out of range!");
+        }
+        return my_span<T, Count>(data_m + Offset, Count);
+    }
+
+    constexpr T* begin() const noexcept {
+        return data_m;
+    }
+
+    constexpr const T* cbegin() const noexcept {
+        return data_m;
+    }
+
+    constexpr T* end() const noexcept {
+        return data_m + size();
+    }
+
+    constexpr const T* cend() const noexcept {
+        return data_m + size();
+    }
+
+    std::reverse_iterator<T*> rbegin() const {
+        return std::reverse_iterator<T*>(end());
+    }
+
+    std::reverse_iterator<T*> rend() const {
+        return std::reverse_iterator<T*>(begin());
+    }
+
+private:
+    T *data_m;
+    size_t size_m;
+};
+
+template<typename T, size_t N>
+my_span(T (&)[N]) -> my_span<T, N>;
+
+template<typename T>
+my_span(my_vector<T> &) -> my_span<T>;
+
+template<typename T>
+my_span(const my_vector<T> &) -> my_span<const T>;
+
+template<typename T>
+my_span(my_compact_vector<T> &) -> my_span<T>;
+
+template<typename T>
+my_span(const my_compact_vector<T> &) -> my_span<const T>;
+
+template<typename T, size_t N>
+my_span(my_array<T, N> &) -> my_span<T, N>;
+
+template<typename T, size_t N>
+my_span(const my_array<T, N> &) -> my_span<const T, N>;
+
+#endif //MY_VECTOR_MY_SPAN_HPP
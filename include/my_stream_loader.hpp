@@ -0,0 +1,212 @@
+#ifndef MY_VECTOR_MY_STREAM_LOADER_HPP
+#define MY_VECTOR_MY_STREAM_LOADER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include "my_span.hpp"
+#include "my_vector.hpp"
+
+struct my_stream_options {
+    // bytes read from the file per chunk
+    size_t chunk_bytes = size_t(1) << 20;
+    // my_load_parsed: expected input bytes per parsed element; when set the
+    // result is reserved from the file size up front
+    size_t bytes_per_element = 0;
+};
+
+// Streams a file through on_chunk(my_span<const char> chunk, bool last),
+// called on the calling thread for consecutive pieces of the file. A
+// background thread reads the next chunk into the other of two buffers
+// while the current one is processed, so reading and parsing overlap.
+//
+// on_chunk returns how many leading bytes it consumed; the rest (say, a line
+// cut off by the chunk boundary) is passed again at the front of the next
+// chunk. last is true for the final call. Exceptions from on_chunk or from
+// reading are rethrown here after the reader thread has stopped. Returns the
+// number of bytes read.
+template<typename OnChunk>
+size_t my_stream_chunks(const std::string &path, OnChunk on_chunk, const my_stream_options &options = my_stream_options()) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("The file cannot be opened!");
+    }
+    const size_t chunk = std::max<size_t>(options.chunk_bytes, 1);
+
+    // The reader fills [chunk, 2 * chunk) of a buffer; the first half is
+    // headroom where the unconsumed tail of the previous chunk is copied,
+    // so that it precedes the new bytes without moving them.
+    my_vector<char> buffers[2];
+    for (auto &buffer : buffers) {
+        buffer.resize_with(2 * chunk, [](char*, size_t) {});
+    }
+    struct slot {
+        size_t bytes = 0;
+        bool full = false;
+        bool last = false;
+    };
+    slot slots[2];
+    std::mutex mutex;
+    std::condition_variable changed;
+    bool stop = false;
+    std::exception_ptr read_error;
+
+    std::thread reader([&]() {
+        try {
+            for (size_t k = 0;; ++k) {
+                slot &current = slots[k & 1];
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    changed.wait(lock, [&]() { return stop || !current.full; });
+                    if (stop) {
+                        return;
+                    }
+                }
+                file.read(buffers[k & 1].begin() + chunk, static_cast<std::streamsize>(chunk));
+                if (file.bad()) {
+                    throw std::runtime_error("Reading the file failed!");
+                }
+                size_t bytes = static_cast<size_t>(file.gcount());
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    current.bytes = bytes;
+                    current.last = bytes < chunk;
+                    current.full = true;
+                }
+                changed.notify_all();
+                if (bytes < chunk) {
+                    return;
+                }
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            read_error = std::current_exception();
+            changed.notify_all();
+        }
+    });
+
+    auto release = [&](slot &done) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.full = false;
+        }
+        changed.notify_all();
+    };
+
+    size_t total = 0;
+    try {
+        // a carried tail longer than the headroom is kept here instead
+        my_vector<char> overflow;
+        bool use_overflow = false;
+        size_t carry = 0;
+        for (size_t k = 0;; ++k) {
+            slot &current = slots[k & 1];
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&]() { return current.full || read_error; });
+                if (read_error && !current.full) {
+                    std::rethrow_exception(read_error);
+                }
+            }
+            char* data = buffers[k & 1].begin() + chunk;
+            size_t bytes = current.bytes;
+            bool last = current.last;
+            total += bytes;
+
+            char* first = data - carry;
+            if (use_overflow) {
+                overflow.insert(overflow.end(), my_span<const char>(data, bytes));
+                first = overflow.begin();
+                bytes = overflow.size();
+            } else {
+                bytes += carry;
+            }
+
+            size_t consumed = std::min(on_chunk(my_span<const char>(first, bytes), last), bytes);
+            if (last) {
+                release(current);
+                break;
+            }
+
+            // hand the tail to the next buffer before this one is reused
+            size_t left = bytes - consumed;
+            if (left <= chunk) {
+                std::memmove(buffers[(k + 1) & 1].begin() + chunk - left, first + consumed, left);
+                use_overflow = false;
+                overflow.clear();
+                carry = left;
+            } else {
+                my_vector<char> tail(first + consumed, first + bytes);
+                overflow = std::move(tail);
+                use_overflow = true;
+                carry = 0;
+            }
+            release(current);
+        }
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        changed.notify_all();
+        reader.join();
+        throw;
+    }
+    reader.join();
+    return total;
+}
+
+// Loads a file of raw T records. The result is sized from the file size
+// and the bytes are read straight into it: there is nothing to parse, so a
+// second buffer would only add a copy.
+template<typename T> requires std::is_trivially_copyable_v<T>
+my_vector<T> my_load_records(const std::string &path) {
+    std::error_code error;
+    size_t file_bytes = std::filesystem::file_size(path, error);
+    std::ifstream file(path, std::ios::binary);
+    if (error || !file) {
+        throw std::runtime_error("The file cannot be opened!");
+    }
+    if (file_bytes % sizeof(T) != 0) {
+        throw std::runtime_error("The file size is not a multiple of the record size!");
+    }
+    my_vector<T> result;
+    result.resize_with(file_bytes / sizeof(T), [](T*, size_t) {});
+    file.read(reinterpret_cast<char*>(result.begin()), static_cast<std::streamsize>(file_bytes));
+    if (static_cast<size_t>(file.gcount()) != file_bytes) {
+        throw std::runtime_error("Reading the file failed!");
+    }
+    return result;
+}
+
+// Parses a file into a my_vector with parse(my_span<const char> text,
+// bool last, my_vector<T> &out), which appends the elements found in text
+// and returns the bytes it consumed (see my_stream_chunks). With
+// options.bytes_per_element set, the result is reserved from the file size.
+template<typename T, typename Parse>
+my_vector<T> my_load_parsed(const std::string &path, Parse parse, const my_stream_options &options = my_stream_options()) {
+    my_vector<T> result;
+    if (options.bytes_per_element != 0) {
+        std::error_code error;
+        size_t file_bytes = std::filesystem::file_size(path, error);
+        if (!error) {
+            result.reserve(file_bytes / options.bytes_per_element + 1);
+        }
+    }
+    my_stream_chunks(path, [&](my_span<const char> text, bool last) {
+        return parse(text, last, result);
+    }, options);
+    return result;
+}
+
+#endif //MY_VECTOR_MY_STREAM_LOADER_HPP
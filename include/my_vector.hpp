@@ -4,6 +4,12 @@
 #include <iterator>
 #include <cstddef>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "my_span.hpp"
+#include "my_vector_recycler.hpp"
 
 template<typename T>
 class my_vector {
@@ -11,7 +17,7 @@ public:
     my_vector() : size_m(0), capacity_m(0), data(nullptr) {};
 
     my_vector(const int &n, const T &d) : size_m(n), capacity_m(n * 2) {
-        data = new T[capacity_m];
+        data = allocate(capacity_m);
         for (size_t i = 0; i < n; ++i) {
             data[i] = d;
         }
@@ -21,7 +27,7 @@ public:
     my_vector(Iter start_interval, Iter end_interval) {
         size_m = end_interval - start_interval;
         capacity_m = size_m * 2;
-        data = new T[capacity_m];
+        data = allocate(capacity_m);
         T* current = data;
         while (start_interval != end_interval) {
             *current = *start_interval;
@@ -30,10 +36,18 @@ public:
         }
     }
 
+    explicit my_vector(my_span<const T> items) : my_vector(items.begin(), items.end()) {}
+
+    // Evaluates a lazy element-wise expression (see my_expr.hpp) in one pass.
+    template<typename Expr> requires requires { typename Expr::my_expression_tag; }
+    my_vector(const Expr &expr) : my_vector() {
+        *this = expr;
+    }
+
     my_vector(const std::initializer_list<T> &arg) {
         size_m = arg.size();
         capacity_m = size_m * 2;
-        data = new T[capacity_m];
+        data = allocate(capacity_m);
         size_t i = 0;
         for (const auto &elem : arg) {
             data[i] = elem;
@@ -43,7 +57,7 @@ public:
 
     // copy constructor
     my_vector(const my_vector &other) : size_m(other.size_m), capacity_m(other.capacity_m) {
-        data = new T[capacity_m];
+        data = allocate(capacity_m);
         for (size_t i = 0; i < size_m; ++i) {
             data[i] = other[i];
         }
@@ -51,31 +65,39 @@ public:
 
     // move constructor
     my_vector(my_vector &&other) noexcept :
-            size_m(other.size_m), capacity_m(other.capacity_m), data(other.data) {
+            data(other.data), size_m(other.size_m), capacity_m(other.capacity_m) {
         other.data = nullptr;
-        other.size = 0;
-        other.capacity = 0;
+        other.size_m = 0;
+        other.capacity_m = 0;
     };
 
 
-    // copy assignment
+    // copy assignment, reuses the current buffer when it is big enough
     my_vector& operator=(const my_vector &other) {
         if (&other != this) {
-            delete[] data;
-            size_m = other.size_m;
-            capacity_m = other.capacity_m;
-            data = new T[capacity_m];
-            for (size_t i = 0; i < size_m; ++i) {
-                data[i] = other[i];
+            if (other.size_m <= capacity_m) {
+                std::copy(other.data, other.data + other.size_m, data);
+                for (size_t i = other.size_m; i < size_m; ++i) {
+                    data[i] = T();
+                }
+                size_m = other.size_m;
+                return *this;
             }
+            size_t new_capacity = other.capacity_m;
+            T* new_data = allocate(new_capacity);
+            std::copy(other.data, other.data + other.size_m, new_data);
+            deallocate(data, capacity_m);
+            data = new_data;
+            size_m = other.size_m;
+            capacity_m = new_capacity;
         }
         return *this;
     }
 
-    // move constructor
+    // move assignment
     my_vector& operator=(my_vector &&other) noexcept {
         if (&other != this) {
-            delete[] data;
+            deallocate(data, capacity_m);
             size_m = other.size_m;
             capacity_m = other.capacity_m;
             data = other.data;
@@ -88,7 +110,7 @@ public:
 
 
     ~my_vector() {
-        delete[] data;
+        deallocate(data, capacity_m);
         size_m = 0;
         capacity_m = 0;
     }
@@ -116,41 +138,92 @@ public:
         return capacity_m;
     }
 
+    // The assign overloads replace the contents, reusing the current buffer
+    // when it is big enough and allocating once otherwise.
+    void assign(size_t n, const T &value) {
+        size_t capacity;
+        T* target = prepare_assign(n, capacity);
+        std::fill_n(target, n, value);
+        finish_assign(target, n, capacity);
+    }
+
+    template<typename Iter> requires (!std::is_integral_v<Iter>)
+    void assign(Iter first, Iter last) {
+        size_t n = std::distance(first, last);
+        size_t capacity;
+        T* target = prepare_assign(n, capacity);
+        if constexpr (std::is_trivially_copyable_v<T> && std::contiguous_iterator<Iter> &&
+                      std::is_same_v<std::iter_value_t<Iter>, T>) {
+            if (n != 0) {
+                std::memmove(target, std::to_address(first), n * sizeof(T));
+            }
+        } else {
+            std::copy(first, last, target);
+        }
+        finish_assign(target, n, capacity);
+    }
+
+    void assign(const std::initializer_list<T> &arg) {
+        assign(arg.begin(), arg.end());
+    }
+
+    void assign(my_span<const T> items) {
+        assign(items.begin(), items.end());
+    }
+
+    // Element i of the expression only reads element i of its operands, so
+    // this vector may itself appear in the expression.
+    template<typename Expr> requires requires { typename Expr::my_expression_tag; }
+    my_vector& operator=(const Expr &expr) {
+        const Expr local = expr;
+        size_t n = local.size();
+        size_t capacity;
+        T* target = prepare_assign(n, capacity);
+        for (size_t i = 0; i < n; ++i) {
+            target[i] = static_cast<T>(local[i]);
+        }
+        finish_assign(target, n, capacity);
+        return *this;
+    }
+
     void reserve(size_t value) {
         if (value <= capacity_m) {
             return;
         }
-        T* new_data = new T[value];
+        T* new_data = allocate(value);
         for (size_t i = 0; i < size_m; ++i) {
-            new_data[i] = data[i];
+            new_data[i] = std::move(data[i]);
         }
-        delete[] data;
+        deallocate(data, capacity_m);
         data = new_data;
         capacity_m = value;
     }
 
+    // Bypasses the recycler's power-of-two rounding, so that the capacity
+    // really becomes size(); deallocate() takes such buffers back as usual.
     void shrink_to_fit() {
         if (capacity_m == size_m) {
             return;
         }
         T* new_data = new T[size_m];
         for (size_t i = 0; i < size_m; ++i) {
-            new_data[i] = data[i];
+            new_data[i] = std::move(data[i]);
         }
-        delete[] data;
+        deallocate(data, capacity_m);
         data = new_data;
         capacity_m = size_m;
     }
 
-    void swap(my_vector &other) {
+    void swap(my_vector &other) noexcept {
         std::swap(data, other.data);
         std::swap(size_m, other.size_m);
         std::swap(capacity_m, other.capacity_m);
     }
 
     void clear() {
+        // slots live until delete[], so they are reset rather than destroyed
         for (size_t i = 0; i < size_m; ++i) {
-            data[i].~T();
+            data[i] = T();
         }
         size_m = 0;
     }
@@ -159,21 +232,22 @@ public:
         if (value == size_m) return;
         if (size_m > value) {
             for (size_t i = value; i < size_m; ++i) {
-                data[i].~T();
+                data[i] = T();
             }
             size_m = value;
         } else {
             if (value > capacity_m) {
-                T* new_data = new T[value * 2];
+                size_t new_capacity = value * 2;
+                T* new_data = allocate(new_capacity);
                 for (size_t i = 0; i < size_m; ++i) {
-                    new_data[i] = data[i];
+                    new_data[i] = std::move(data[i]);
                 }
                 for (size_t i = size_m; i < value; ++i) {
                     new_data[i] = elem;
                 }
+                deallocate(data, capacity_m);
                 size_m = value;
-                capacity_m = value * 2;
-                delete[] data;
+                capacity_m = new_capacity;
                 data = new_data;
             } else {
                 for (size_t i = size_m; i < value; ++i) {
@@ -184,43 +258,76 @@ public:
         }
     }
 
+    // Grows to value elements and lets init(first, count) write the new
+    // tail. The buffer is allocated with exactly value slots (rounded up to a
+    // power of two while my_vector_recycler is enabled) and, for trivial
+    // types, its new pages are first written by init itself.
+    template<typename Init>
+    void resize_with(size_t value, Init init) {
+        if (value <= size_m) {
+            resize(value);
+            return;
+        }
+        if (value > capacity_m) {
+            size_t new_capacity = value;
+            T* new_data = allocate(new_capacity);
+            for (size_t i = 0; i < size_m; ++i) {
+                new_data[i] = std::move(data[i]);
+            }
+            deallocate(data, capacity_m);
+            data = new_data;
+            capacity_m = new_capacity;
+        }
+        init(data + size_m, value - size_m);
+        size_m = value;
+    }
+
 
     T* insert(T* pos, const T &value) {
         size_t index = pos - begin();
 
         if (size_m == capacity_m) {
-            T* new_data = new T[capacity_m * 2];
+            size_t new_capacity = (capacity_m == 0) ? 1 : capacity_m * 2;
+            T* new_data = allocate(new_capacity);
+            new_data[index] = value;
             for (size_t i = 0; i < index; ++i) {
-                new_data[i] = data[i];
+                new_data[i] = std::move(data[i]);
             }
-            new_data[index] = value;
             for (size_t i = index + 1; i < size_m + 1; ++i) {
-                new_data[i] = data[i - 1];
+                new_data[i] = std::move(data[i - 1]);
             }
-            delete[] data;
+            deallocate(data, capacity_m);
             data = new_data;
-            capacity_m *= 2;
+            capacity_m = new_capacity;
+        } else if (index == size_m) {
+            data[index] = value;
         } else {
+            // value may refer to an element that is about to be shifted
+            T copy = value;
             for (size_t i = size_m; i > index; --i) {
-                data[i] = data[i - 1];
+                data[i] = std::move(data[i - 1]);
             }
-            data[index] = value;
+            data[index] = std::move(copy);
         }
         size_m++;
         return begin() + index;
     }
 
 
-    T* insert(T* pos, T* begin_take, T* end_take) {
+    T* insert(T* pos, const T* begin_take, const T* end_take) {
         size_t index = pos - begin();
+        if (begin_take == end_take) {
+            return begin() + index;
+        }
         size_t size = end_take - begin_take;
         if (size_m + size >= capacity_m) {
-            T* new_data = new T[capacity_m * 2];
+            size_t new_capacity = (size_m + size) * 2;
+            T* new_data = allocate(new_capacity);
             for (size_t i = 0; i < index; ++i) {
-                new_data[i] = data[i];
+                new_data[i] = std::move(data[i]);
             }
             for (size_t i = index; i < size_m; ++i) {
-                new_data[i + size] = data[i];
+                new_data[i + size] = std::move(data[i]);
             }
             size_t i = 0;
             while (begin_take != end_take) {
@@ -229,13 +336,13 @@ public:
                 i++;
             }
 
+            deallocate(data, capacity_m);
             size_m += size;
-            capacity_m = size_m * 2;
-            delete[] data;
+            capacity_m = new_capacity;
             data = new_data;
         } else {
             for (size_t i = size_m; i > index; --i) {
-                data[i + size - 1] = data[i - 1];
+                data[i + size - 1] = std::move(data[i - 1]);
             }
             size_t i = 0;
             while (begin_take != end_take) {
@@ -248,30 +355,37 @@ public:
         return begin() + index;
     }
 
+    T* insert(T* pos, my_span<const T> items) {
+        return insert(pos, items.begin(), items.end());
+    }
+
     T* erase(const size_t pos) {
         for (size_t i = pos; i < size_m - 1; ++i) {
-            data[i] = data[i + 1];
+            data[i] = std::move(data[i + 1]);
         }
-        data[size_m - 1].~T();
+        data[size_m - 1] = T();
         size_m--;
         return begin() + pos;
     }
 
     T* erase(T* begin_, T* end) {
         size_t first_ind = begin_ - data;
+        if (begin_ == end) {
+            return begin() + first_ind;
+        }
         size_t size = end - begin_;
         for (size_t i = first_ind; i < size_m - size; ++i) {
-            data[i] = data[i + size];
+            data[i] = std::move(data[i + size]);
         }
         for (size_t i = size_m - size; i < size_m; ++i) {
-            data[i].~T();
+            data[i] = T();
         }
         size_m -= size;
         return begin() + first_ind;
     }
 
     void pop_back() {
-        data[size_m - 1].~T();
+        data[size_m - 1] = T();
         size_m--;
     }
 
@@ -283,20 +397,24 @@ public:
         if (size_m == capacity_m) {
             size_t new_capacity = (capacity_m == 0) ? 1 : capacity_m * 2;
 
-            T* new_data = new T[new_capacity];
+            T* new_data = allocate(new_capacity);
             for (size_t i = 0; i < size_m; ++i) {
                 new_data[i] = std::move(data[i]);
             }
 
-            delete[] data;
+            deallocate(data, capacity_m);
             data = new_data;
             capacity_m = new_capacity;
         }
 
-        new (&data[size_m]) T(std::move(value));
+        data[size_m] = std::move(value);
         ++size_m;
     }
 
+    friend void swap(my_vector<T>& lhs, my_vector<T>& rhs) noexcept {
+        lhs.swap(rhs);
+    }
+
     friend bool operator==(const my_vector<T>& lhs, const my_vector<T>& rhs) {
         if (lhs.size_m != rhs.size_m) return false;
         for (size_t i = 0; i < lhs.size_m; ++i) {
@@ -368,6 +486,38 @@ public:
 
 
 private:
+    // All storage comes from my_vector_recycler, which is plain new[]/delete[]
+    // unless recycling was enabled on this thread; acquire may round the
+    // capacity up.
+    static T* allocate(size_t &capacity) {
+        return my_vector_recycler<T>::acquire(capacity);
+    }
+
+    static void deallocate(T* buffer, size_t capacity) {
+        my_vector_recycler<T>::release(buffer, capacity);
+    }
+
+    // Returns the buffer the new contents should be written to: the current
+    // one if it fits, otherwise a fresh one (the source may still live in
+    // the old buffer, so it is released only in finish_assign).
+    T* prepare_assign(size_t n, size_t &capacity) {
+        capacity = n;
+        return n <= capacity_m ? data : allocate(capacity);
+    }
+
+    void finish_assign(T* target, size_t n, size_t capacity) {
+        if (target != data) {
+            deallocate(data, capacity_m);
+            data = target;
+            capacity_m = capacity;
+        } else {
+            for (size_t i = n; i < size_m; ++i) {
+                data[i] = T();
+            }
+        }
+        size_m = n;
+    }
+
     T *data;
     size_t size_m;
     size_t capacity_m;
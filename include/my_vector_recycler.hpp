@@ -0,0 +1,151 @@
+#ifndef MY_VECTOR_MY_VECTOR_RECYCLER_HPP
+#define MY_VECTOR_MY_VECTOR_RECYCLER_HPP
+
+#include <cstddef>
+#include <bit>
+#include <type_traits>
+
+struct my_recycler_stats {
+    // allocations served from the cache / from operator new
+    size_t hits = 0;
+    size_t misses = 0;
+    // released buffers kept for reuse / freed because a limit was reached
+    size_t recycled = 0;
+    size_t dropped = 0;
+    size_t cached_buffers = 0;
+    size_t cached_bytes = 0;
+};
+
+// Opt-in, per-thread free lists for my_vector<T> buffers. my_vector
+// allocations (except shrink_to_fit, which needs an exact size) and all
+// releases go through acquire()/release(); while recycling is disabled
+// (the default) they are plain new T[] / delete[].
+//
+// Once enable() is called on a thread, allocations there are rounded up to
+// a power-of-two capacity and buffers with a power-of-two capacity that are
+// released on that thread are kept in the bucket of their capacity, to be
+// handed to the next allocation of that size. Only trivially destructible
+// T is recycled, since a cached buffer keeps its old element values. The
+// cache holds at most max_per_bucket buffers per size and max_bytes in
+// total; trim() and disable() give the memory back.
+template<typename T>
+class my_vector_recycler {
+public:
+    static constexpr size_t buckets = 48;
+    static constexpr size_t max_per_bucket = 8;
+
+    static void enable(size_t max_bytes = size_t(16) << 20) {
+        if constexpr (recyclable) {
+            state& s = local();
+            if (!s.registered) {
+                // registered once per thread; frees the cache at thread exit
+                static thread_local cleanup guard;
+                (void) guard;
+                s.registered = true;
+            }
+            s.enabled = true;
+            s.max_bytes = max_bytes;
+            trim(max_bytes);
+        }
+    }
+
+    static void disable() {
+        local().enabled = false;
+        trim(0);
+    }
+
+    [[nodiscard]] static bool is_enabled() {
+        return local().enabled;
+    }
+
+    // Frees cached buffers, largest first, until at most max_bytes remain.
+    static void trim(size_t max_bytes = 0) {
+        state& s = local();
+        for (size_t bucket = buckets; bucket-- > 0 && s.stats.cached_bytes > max_bytes;) {
+            while (s.counts[bucket] != 0 && s.stats.cached_bytes > max_bytes) {
+                delete[] s.buffers[bucket][--s.counts[bucket]];
+                --s.stats.cached_buffers;
+                s.stats.cached_bytes -= (size_t(1) << bucket) * sizeof(T);
+            }
+        }
+    }
+
+    [[nodiscard]] static my_recycler_stats stats() {
+        return local().stats;
+    }
+
+    static void reset_stats() {
+        state& s = local();
+        s.stats.hits = 0;
+        s.stats.misses = 0;
+        s.stats.recycled = 0;
+        s.stats.dropped = 0;
+    }
+
+    // Returns a buffer of at least capacity elements; capacity is updated to
+    // the real size of the buffer.
+    static T* acquire(size_t &capacity) {
+        state& s = local();
+        if (!s.enabled || capacity == 0) {
+            return new T[capacity];
+        }
+        capacity = std::bit_ceil(capacity);
+        size_t bucket = std::countr_zero(capacity);
+        if (bucket < buckets && s.counts[bucket] != 0) {
+            ++s.stats.hits;
+            --s.stats.cached_buffers;
+            s.stats.cached_bytes -= capacity * sizeof(T);
+            return s.buffers[bucket][--s.counts[bucket]];
+        }
+        ++s.stats.misses;
+        return new T[capacity];
+    }
+
+    // Takes back a buffer of capacity elements obtained from acquire().
+    static void release(T* buffer, size_t capacity) {
+        if (buffer == nullptr) {
+            return;
+        }
+        state& s = local();
+        if (s.enabled && std::has_single_bit(capacity)) {
+            size_t bucket = std::countr_zero(capacity);
+            if (bucket < buckets && s.counts[bucket] < max_per_bucket &&
+                s.stats.cached_bytes + capacity * sizeof(T) <= s.max_bytes) {
+                s.buffers[bucket][s.counts[bucket]++] = buffer;
+                ++s.stats.recycled;
+                ++s.stats.cached_buffers;
+                s.stats.cached_bytes += capacity * sizeof(T);
+                return;
+            }
+            ++s.stats.dropped;
+        }
+        delete[] buffer;
+    }
+
+private:
+    static constexpr bool recyclable = std::is_trivially_destructible_v<T>;
+
+    // Trivially destructible, so it stays usable while other thread_local
+    // objects (possibly holding my_vectors) are destroyed at thread exit.
+    struct state {
+        T* buffers[buckets][max_per_bucket];
+        size_t counts[buckets];
+        size_t max_bytes;
+        my_recycler_stats stats;
+        bool enabled;
+        bool registered;
+    };
+
+    struct cleanup {
+        ~cleanup() {
+            disable();
+        }
+    };
+
+    static state& local() {
+        static thread_local state s{};
+        return s;
+    }
+};
+
+#endif //MY_VECTOR_MY_VECTOR_RECYCLER_HPP
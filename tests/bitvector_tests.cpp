@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "my_bitvector.hpp"
+
+
+TEST(bitvectorTests, PushBackAndAccess) {
+    my_bitvector bits;
+    EXPECT_TRUE(bits.is_empty());
+    for (size_t i = 0; i < 130; ++i) {
+        bits.push_back(i % 3 == 0);
+    }
+    EXPECT_EQ(bits.size(), 130);
+    for (size_t i = 0; i < 130; ++i) {
+        EXPECT_EQ(bits[i], i % 3 == 0);
+    }
+    EXPECT_EQ(bits.words().size(), 3);
+    bits.pop_back();
+    EXPECT_EQ(bits.size(), 129);
+}
+
+TEST(bitvectorTests, SetResetFlip) {
+    my_bitvector bits(100);
+    bits.set(3);
+    bits.set(99);
+    EXPECT_TRUE(bits.test(3));
+    EXPECT_TRUE(bits.test(99));
+    bits.reset(3);
+    EXPECT_FALSE(bits.test(3));
+    bits.flip(4);
+    EXPECT_TRUE(bits.test(4));
+    EXPECT_THROW(bits.set(100), std::out_of_range);
+    EXPECT_THROW((void) bits.test(100), std::out_of_range);
+}
+
+TEST(bitvectorTests, Resize) {
+    my_bitvector bits(10, true);
+    EXPECT_EQ(bits.count(), 10);
+    bits.resize(200, true);
+    EXPECT_EQ(bits.count(), 200);
+    bits.resize(70);
+    EXPECT_EQ(bits.count(), 70);
+    bits.resize(140);
+    EXPECT_EQ(bits.count(), 70);
+    EXPECT_FALSE(bits[100]);
+}
+
+TEST(bitvectorTests, SetAndClearRange) {
+    my_bitvector bits(300);
+    bits.set_range(10, 250);
+    EXPECT_EQ(bits.count(), 240);
+    EXPECT_FALSE(bits[9]);
+    EXPECT_TRUE(bits[10]);
+    EXPECT_TRUE(bits[249]);
+    EXPECT_FALSE(bits[250]);
+    bits.clear_range(64, 128);
+    EXPECT_EQ(bits.count(), 176);
+    EXPECT_TRUE(bits[63]);
+    EXPECT_FALSE(bits[64]);
+    EXPECT_TRUE(bits[128]);
+    EXPECT_THROW(bits.set_range(5, 301), std::out_of_range);
+}
+
+TEST(bitvectorTests, WordwiseOperators) {
+    my_bitvector a(100);
+    my_bitvector b(100);
+    a.set_range(0, 60);
+    b.set_range(40, 100);
+    EXPECT_EQ((a & b).count(), 20);
+    EXPECT_EQ((a | b).count(), 100);
+    EXPECT_EQ((a ^ b).count(), 80);
+    a ^= a;
+    EXPECT_EQ(a.count(), 0);
+    my_bitvector c(99);
+    EXPECT_THROW(a |= c, std::invalid_argument);
+}
+
+TEST(bitvectorTests, RankAndSelectMatchNaive) {
+    my_bitvector bits;
+    std::vector<size_t> ones;
+    for (size_t i = 0; i < 5000; ++i) {
+        bool value = (i * 7919) % 11 < 4;
+        bits.push_back(value);
+        if (value) {
+            ones.push_back(i);
+        }
+    }
+    bits.build_index();
+    size_t running = 0;
+    for (size_t i = 0; i <= bits.size(); ++i) {
+        EXPECT_EQ(bits.rank(i), running);
+        if (i < bits.size() && bits[i]) {
+            ++running;
+        }
+    }
+    for (size_t k = 0; k < ones.size(); ++k) {
+        EXPECT_EQ(bits.select(k), ones[k]);
+    }
+    EXPECT_THROW((void) bits.select(ones.size()), std::out_of_range);
+}
+
+TEST(bitvectorTests, IndexRebuiltAfterModification) {
+    my_bitvector bits(1000);
+    EXPECT_FALSE(bits.is_index_built());
+    EXPECT_THROW((void) bits.rank(0), std::logic_error);
+    bits.set(500);
+    bits.build_index();
+    EXPECT_TRUE(bits.is_index_built());
+    EXPECT_EQ(bits.rank(1000), 1);
+    EXPECT_EQ(bits.select(0), 500);
+    bits.set(10);
+    EXPECT_FALSE(bits.is_index_built());
+    EXPECT_THROW((void) bits.select(0), std::logic_error);
+    bits.build_index();
+    EXPECT_EQ(bits.rank(1000), 2);
+    EXPECT_EQ(bits.select(0), 10);
+    EXPECT_EQ(bits.select(1), 500);
+}
+
+TEST(bitvectorTests, ConcurrentQueriesAfterBuild) {
+    my_bitvector bits;
+    for (size_t i = 0; i < 20000; ++i) {
+        bits.push_back(i % 3 == 0);
+    }
+    bits.build_index();
+    std::vector<std::thread> readers;
+    std::vector<size_t> mismatches(4, 0);
+    for (size_t t = 0; t < 4; ++t) {
+        readers.emplace_back([&bits, &mismatches, t]() {
+            for (size_t k = t; k < 6000; k += 4) {
+                if (bits.select(k) != 3 * k || bits.rank(3 * k + 1) != k + 1) {
+                    ++mismatches[t];
+                }
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    for (size_t count : mismatches) {
+        EXPECT_EQ(count, 0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
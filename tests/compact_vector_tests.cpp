@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include "my_compact_vector.hpp"
+
+
+TEST(compactVectorTests, SizeOfIsOnePointer) {
+    EXPECT_EQ(sizeof(my_compact_vector<uint32_t>), sizeof(void*));
+    EXPECT_EQ(sizeof(my_compact_vector<std::string>), sizeof(void*));
+}
+
+TEST(compactVectorTests, DefaultConstructorDoesNotAllocate) {
+    my_compact_vector<int> v;
+    EXPECT_TRUE(v.is_empty());
+    EXPECT_EQ(v.size(), 0);
+    EXPECT_EQ(v.capacity(), 0);
+    EXPECT_EQ(v.begin(), nullptr);
+}
+
+TEST(compactVectorTests, Constructors) {
+    my_compact_vector<int> filled(3, 7);
+    EXPECT_EQ(filled.size(), 3);
+    EXPECT_EQ(filled[2], 7);
+
+    std::vector<int> source{1, 2, 3};
+    my_compact_vector<int> ranged(source.begin(), source.end());
+    EXPECT_EQ(ranged.size(), 3);
+    EXPECT_EQ(ranged[1], 2);
+
+    my_compact_vector<std::string> strings{"adjacency", "list"};
+    EXPECT_EQ(strings.size(), 2);
+    EXPECT_EQ(strings[1], "list");
+}
+
+TEST(compactVectorTests, CopyAndMove) {
+    my_compact_vector<std::string> a{"a", "b", "c"};
+    my_compact_vector<std::string> b = a;
+    EXPECT_EQ(a, b);
+    my_compact_vector<std::string> c = std::move(a);
+    EXPECT_EQ(c, b);
+    EXPECT_TRUE(a.is_empty());
+    a = c;
+    EXPECT_EQ(a, c);
+}
+
+TEST(compactVectorTests, PushBackGrows) {
+    my_compact_vector<uint32_t> v;
+    for (uint32_t i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(v.size(), 100);
+    EXPECT_GE(v.capacity(), 100);
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(v[i], i);
+    }
+    v.emplace_back(100);
+    EXPECT_EQ(v.back(), 100);
+}
+
+TEST(compactVectorTests, InsertAndErase) {
+    my_compact_vector<std::string> v{"a", "d"};
+    v.insert(v.begin() + 1, "b");
+    std::string more[] = {"c", "x", "y"};
+    v.insert(v.begin() + 2, more, more + 1);
+    v.insert(v.end(), more + 1, more + 3);
+    my_compact_vector<std::string> expected{"a", "b", "c", "d", "x", "y"};
+    EXPECT_EQ(v, expected);
+
+    v.erase(0);
+    v.erase(v.begin() + 3, v.end());
+    my_compact_vector<std::string> trimmed{"b", "c", "d"};
+    EXPECT_EQ(v, trimmed);
+    v.pop_back();
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v.back(), "c");
+}
+
+TEST(compactVectorTests, ResizeReserveShrink) {
+    my_compact_vector<int> v{1, 2};
+    v.resize(5, 9);
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v[4], 9);
+    v.resize(1);
+    EXPECT_EQ(v.size(), 1);
+    v.reserve(50);
+    EXPECT_EQ(v.capacity(), 50);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 1);
+    v.clear();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 0);
+}
+
+TEST(compactVectorTests, AtThrow) {
+    my_compact_vector<int> v{1};
+    EXPECT_THROW(v.at(1), std::out_of_range);
+    my_compact_vector<int> empty;
+    EXPECT_THROW(empty.at(0), std::out_of_range);
+}
+
+TEST(compactVectorTests, OveralignedElements) {
+    struct alignas(32) wide {
+        double value = 0;
+    };
+    my_compact_vector<wide> v;
+    v.push_back(wide{1.5});
+    v.push_back(wide{2.5});
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(v.begin()) % 32, 0);
+    EXPECT_EQ(v[1].value, 2.5);
+}
+
+TEST(compactVectorTests, NestedAdjacencyList) {
+    my_compact_vector<my_compact_vector<uint32_t>> graph;
+    graph.resize(4);
+    graph[0].push_back(1);
+    graph[0].push_back(2);
+    graph[3].push_back(0);
+    EXPECT_EQ(graph[0].size(), 2);
+    EXPECT_TRUE(graph[1].is_empty());
+    EXPECT_EQ(graph[3][0], 0);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <new>
+#include "my_expr.hpp"
+
+static size_t allocation_count = 0;
+
+void* operator new(size_t size) {
+    ++allocation_count;
+    if (void* result = std::malloc(size ? size : 1)) {
+        return result;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+
+TEST(exprTests, FusedArithmetic) {
+    my_vector<double> a{1, 2, 3, 4};
+    my_vector<double> b{10, 20, 30, 40};
+    my_vector<double> c = a * 2 + b;
+    my_vector<double> expected{12, 24, 36, 48};
+    EXPECT_EQ(c, expected);
+
+    my_vector<double> d = (b - a) / 2.0 - -a;
+    my_vector<double> expected_d{5.5, 11, 16.5, 22};
+    EXPECT_EQ(d, expected_d);
+
+    my_vector<double> e = 100 - a * a;
+    my_vector<double> expected_e{99, 96, 91, 84};
+    EXPECT_EQ(e, expected_e);
+}
+
+TEST(exprTests, ExpressionIsLazy) {
+    my_vector<int> a{1, 2, 3};
+    auto expr = a + 1;
+    a[0] = 10;
+    EXPECT_EQ(expr.size(), 3);
+    EXPECT_EQ(expr[0], 11);
+    my_vector<int> result = expr;
+    my_vector<int> expected{11, 3, 4};
+    EXPECT_EQ(result, expected);
+}
+
+TEST(exprTests, AssignmentReusesBufferWithoutAllocating) {
+    my_vector<float> a{1, 2, 3, 4, 5, 6, 7, 8};
+    my_vector<float> b{8, 7, 6, 5, 4, 3, 2, 1};
+    my_vector<float> c;
+    c.reserve(8);
+    size_t before = allocation_count;
+    c = a * b + a - b / 2.0f;
+    a = a + a * 3.0f;
+    a += b;
+    EXPECT_EQ(allocation_count, before);
+    EXPECT_EQ(c[0], 1 * 8 + 1 - 4.0f);
+    EXPECT_EQ(a[0], 4 + 8);
+    EXPECT_EQ(a[7], 32 + 1);
+}
+
+TEST(exprTests, SizeMismatchThrows) {
+    my_vector<int> a{1, 2, 3};
+    my_vector<int> b{1, 2};
+    EXPECT_THROW(a + b, std::invalid_argument);
+    EXPECT_THROW(a * 2 - b, std::invalid_argument);
+    my_array<int, 2> arr;
+    EXPECT_THROW(arr = a * 2, std::invalid_argument);
+}
+
+TEST(exprTests, ArraysAndMixedOperands) {
+    my_array<int, 3> x{1, 2, 3};
+    my_array<int, 3> y{4, 5, 6};
+    my_array<int, 3> z = x * y - 1;
+    my_array<int, 3> expected{3, 9, 17};
+    EXPECT_EQ(z, expected);
+
+    my_vector<int> v{1, 1, 1};
+    my_vector<int> w = v + x;
+    my_vector<int> expected_w{2, 3, 4};
+    EXPECT_EQ(w, expected_w);
+
+    z *= 2;
+    z -= x;
+    my_array<int, 3> expected_z{5, 16, 31};
+    EXPECT_EQ(z, expected_z);
+}
+
+TEST(exprTests, ResultConvertsToTargetType) {
+    my_vector<int> a{1, 2, 3};
+    my_vector<double> half = a / 2.0;
+    EXPECT_EQ(half[0], 0.5);
+    my_vector<int> truncated = a / 2.0;
+    my_vector<int> expected{0, 1, 1};
+    EXPECT_EQ(truncated, expected);
+    my_vector<int> empty;
+    my_vector<int> still_empty = empty * 3;
+    EXPECT_TRUE(still_empty.is_empty());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "my_flat_map.hpp"
+
+
+TEST(flatSetTests, InitializerListSortsAndDeduplicates) {
+    my_flat_set<int> s{5, 1, 4, 1, 3, 5};
+    EXPECT_EQ(s.size(), 4);
+    EXPECT_EQ(s[0], 1);
+    EXPECT_EQ(s[1], 3);
+    EXPECT_EQ(s[2], 4);
+    EXPECT_EQ(s[3], 5);
+}
+
+TEST(flatSetTests, InsertAndContains) {
+    my_flat_set<int> s;
+    EXPECT_TRUE(s.is_empty());
+    EXPECT_TRUE(s.insert(10));
+    EXPECT_TRUE(s.insert(2));
+    EXPECT_FALSE(s.insert(10));
+    EXPECT_EQ(s.size(), 2);
+    EXPECT_TRUE(s.contains(2));
+    EXPECT_FALSE(s.contains(3));
+    EXPECT_EQ(s.count(10), 1);
+    EXPECT_EQ(s.find(3), s.end());
+    EXPECT_EQ(*s.find(10), 10);
+}
+
+TEST(flatSetTests, BulkInsertMergesWithExisting) {
+    my_flat_set<int> s{2, 4, 6};
+    std::vector<int> batch{7, 1, 4, 3, 7};
+    s.insert(batch.begin(), batch.end());
+    std::vector<int> expected{1, 2, 3, 4, 6, 7};
+    EXPECT_EQ(s.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(s[i], expected[i]);
+    }
+}
+
+TEST(flatSetTests, Erase) {
+    my_flat_set<int> s{1, 2, 3};
+    EXPECT_TRUE(s.erase(2));
+    EXPECT_FALSE(s.erase(2));
+    EXPECT_EQ(s.size(), 2);
+    EXPECT_EQ(s[0], 1);
+    EXPECT_EQ(s[1], 3);
+}
+
+TEST(flatSetTests, LowerBoundMatchesStd) {
+    my_flat_set<int> s;
+    std::vector<int> values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i * 3);
+    }
+    s.insert(values.begin(), values.end());
+    for (int key = -1; key < 305; ++key) {
+        size_t expected = std::lower_bound(values.begin(), values.end(), key) - values.begin();
+        EXPECT_EQ(s.lower_bound(key), expected);
+    }
+}
+
+TEST(flatMapTests, InsertFindAndAt) {
+    my_flat_map<int, std::string> m;
+    EXPECT_TRUE(m.insert(3, "three"));
+    EXPECT_TRUE(m.insert(1, "one"));
+    EXPECT_FALSE(m.insert(3, "drei"));
+    EXPECT_EQ(m.size(), 2);
+    EXPECT_EQ(m.at(3), "three");
+    EXPECT_EQ(*m.find(1), "one");
+    EXPECT_EQ(m.find(2), nullptr);
+    EXPECT_THROW(m.at(2), std::out_of_range);
+    EXPECT_EQ(m.key_at(0), 1);
+    EXPECT_EQ(m.key_at(1), 3);
+}
+
+TEST(flatMapTests, SubscriptInsertsDefault) {
+    my_flat_map<int, int> m;
+    m[5] += 2;
+    m[1] = 7;
+    m[5] += 3;
+    EXPECT_EQ(m.size(), 2);
+    EXPECT_EQ(m[1], 7);
+    EXPECT_EQ(m[5], 5);
+}
+
+TEST(flatMapTests, BulkInsertKeepsFirstValue) {
+    my_flat_map<int, int> m{{4, 40}, {2, 20}};
+    std::vector<std::pair<int, int>> batch{{3, 30}, {2, 99}, {1, 10}, {3, 77}, {9, 90}};
+    m.insert(batch.begin(), batch.end());
+    EXPECT_EQ(m.size(), 5);
+    int expected_keys[] = {1, 2, 3, 4, 9};
+    int expected_values[] = {10, 20, 30, 40, 90};
+    for (size_t i = 0; i < m.size(); ++i) {
+        EXPECT_EQ(m.key_at(i), expected_keys[i]);
+        EXPECT_EQ(m.value_at(i), expected_values[i]);
+    }
+}
+
+TEST(flatMapTests, EraseKeepsKeysAndValuesAligned) {
+    my_flat_map<int, int> m{{1, 10}, {2, 20}, {3, 30}};
+    EXPECT_TRUE(m.erase(2));
+    EXPECT_FALSE(m.erase(2));
+    EXPECT_EQ(m.size(), 2);
+    EXPECT_EQ(m.at(1), 10);
+    EXPECT_EQ(m.at(3), 30);
+    EXPECT_EQ(m.keys().size(), m.values().size());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
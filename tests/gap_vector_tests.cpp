@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "my_gap_vector.hpp"
+
+template<typename T>
+static bool same_as(const my_gap_vector<T> &gap, const std::vector<T> &expected) {
+    if (gap.size() != expected.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (gap[i] != expected[i]) {
+            return false;
+        }
+    }
+    return std::equal(gap.cbegin(), gap.cend(), expected.begin(), expected.end());
+}
+
+
+TEST(gapVectorTests, Constructors) {
+    my_gap_vector<int> empty;
+    EXPECT_TRUE(empty.is_empty());
+    EXPECT_EQ(empty.capacity(), 0);
+
+    my_gap_vector<int> filled(3, 7);
+    EXPECT_TRUE(same_as(filled, {7, 7, 7}));
+
+    my_gap_vector<std::string> words{"gap", "buffer"};
+    EXPECT_EQ(words.size(), 2);
+    EXPECT_EQ(words.at(1), "buffer");
+    EXPECT_THROW(words.at(2), std::out_of_range);
+
+    my_vector<int> source{1, 2, 3};
+    my_gap_vector<int> from_span(source);
+    EXPECT_TRUE(same_as(from_span, {1, 2, 3}));
+}
+
+TEST(gapVectorTests, EditsAtCursorDoNotShiftTail) {
+    my_gap_vector<int> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(i);
+    }
+    v.move_gap(500);
+    const int* tail = &v[500];
+    for (int i = 0; i < 10; ++i) {
+        v.insert(500 + i, -i);
+    }
+    EXPECT_EQ(&v[510], tail);
+    EXPECT_EQ(v.gap_position(), 510);
+    v.erase(505, 5);
+    EXPECT_EQ(&v[505], tail);
+    EXPECT_EQ(v.size(), 1005);
+    EXPECT_EQ(v[504], -4);
+    EXPECT_EQ(v[505], 500);
+    EXPECT_EQ(v.back(), 999);
+}
+
+TEST(gapVectorTests, RandomEditsMatchStdVector) {
+    std::mt19937 rng(7);
+    my_gap_vector<int> gap;
+    std::vector<int> expected;
+    for (int step = 0; step < 5000; ++step) {
+        size_t pos = expected.empty() ? 0 : rng() % (expected.size() + 1);
+        if (rng() % 3 != 0 || expected.empty()) {
+            gap.insert(pos, step);
+            expected.insert(expected.begin() + pos, step);
+        } else {
+            pos = std::min(pos, expected.size() - 1);
+            gap.erase(pos);
+            expected.erase(expected.begin() + pos);
+        }
+    }
+    EXPECT_TRUE(same_as(gap, expected));
+}
+
+TEST(gapVectorTests, EditsWhileBufferIsFull) {
+    my_gap_vector<std::string> v;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 16; ++i) {
+        v.push_back("s" + std::to_string(i));
+        expected.push_back("s" + std::to_string(i));
+    }
+    ASSERT_EQ(v.size(), v.capacity());
+    v.erase(3);
+    expected.erase(expected.begin() + 3);
+    EXPECT_TRUE(same_as(v, expected));
+
+    v.insert(15, "y");
+    expected.insert(expected.begin() + 15, "y");
+    ASSERT_EQ(v.size(), v.capacity());
+    v.insert(0, "x");
+    expected.insert(expected.begin(), "x");
+    EXPECT_TRUE(same_as(v, expected));
+
+    std::mt19937 rng(3);
+    for (int step = 0; step < 2000; ++step) {
+        size_t pos = rng() % (expected.size() + 1);
+        if (rng() % 3 != 0 || expected.empty()) {
+            std::string value = std::to_string(step);
+            v.insert(pos, value);
+            expected.insert(expected.begin() + pos, value);
+        } else {
+            pos = std::min(pos, expected.size() - 1);
+            v.erase(pos);
+            expected.erase(expected.begin() + pos);
+        }
+    }
+    EXPECT_TRUE(same_as(v, expected));
+    my_span<std::string> all = v.contiguous();
+    EXPECT_TRUE(std::equal(all.begin(), all.end(), expected.begin(), expected.end()));
+}
+
+TEST(gapVectorTests, InsertAliasingOwnElement) {
+    my_gap_vector<std::string> v{"a", "b", "c", "d"};
+    v.move_gap(4);
+    v.insert(0, v[3]);
+    v.insert(5, v[0]);
+    EXPECT_TRUE(same_as(v, {"d", "a", "b", "c", "d", "d"}));
+
+    my_gap_vector<int> nums{1, 2, 3};
+    my_vector<int> more{8, 9};
+    nums.insert(1, more);
+    EXPECT_TRUE(same_as(nums, {1, 8, 9, 2, 3}));
+    // the source lies in the buffer that the insert shifts and regrows
+    nums.move_gap(5);
+    nums.insert(0, my_span<const int>(nums.before_gap()));
+    EXPECT_TRUE(same_as(nums, {1, 8, 9, 2, 3, 1, 8, 9, 2, 3}));
+    nums.insert(2, my_span<const int>(nums.after_gap()));
+    EXPECT_TRUE(same_as(nums, {1, 8, 1, 8, 9, 2, 3, 9, 2, 3, 1, 8, 9, 2, 3}));
+}
+
+TEST(gapVectorTests, IteratorsSkipTheGap) {
+    my_gap_vector<int> v{5, 1, 4, 2, 3};
+    v.move_gap(2);
+    EXPECT_EQ(v.end() - v.begin(), 5);
+    EXPECT_EQ(*(v.begin() + 2), 4);
+    EXPECT_EQ(v.begin()[3], 2);
+    std::sort(v.begin(), v.end());
+    EXPECT_TRUE(same_as(v, {1, 2, 3, 4, 5}));
+    my_gap_vector<int>::const_iterator it = v.begin();
+    EXPECT_EQ(*it, 1);
+    EXPECT_EQ(std::find(v.cbegin(), v.cend(), 4) - v.cbegin(), 3);
+}
+
+TEST(gapVectorTests, ContiguousViewAndSegments) {
+    my_gap_vector<int> v{1, 2, 3, 4};
+    v.move_gap(1);
+    EXPECT_EQ(v.before_gap().size(), 1);
+    EXPECT_EQ(v.after_gap().size(), 3);
+    EXPECT_EQ(v.after_gap()[0], 2);
+
+    my_span<int> all = v.contiguous();
+    EXPECT_EQ(all.size(), 4);
+    EXPECT_EQ(all[3], 4);
+    EXPECT_EQ(v.gap_position(), 4);
+    my_vector<int> expected{1, 2, 3, 4};
+    EXPECT_EQ(v.to_vector(), expected);
+
+    v.clear();
+    EXPECT_TRUE(v.is_empty());
+    v.push_back(9);
+    v.pop_back();
+    EXPECT_TRUE(v.is_empty());
+    EXPECT_THROW(v.erase(0), std::out_of_range);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <string>
+#include "my_array.hpp"
+#include "my_gather.hpp"
+#include "my_span.hpp"
+
+template<typename T, typename Index>
+static void check_all_levels(const my_vector<T> &src, const my_vector<Index> &indices) {
+    for (int level = 0; level <= static_cast<int>(my_detect_simd_level()); ++level) {
+        my_vector<T> out;
+        out.resize(indices.size());
+        my_gather_unchecked(src.cbegin(), src.size(), indices.cbegin(), indices.size(), out.begin(),
+                            static_cast<my_simd_level>(level));
+        for (size_t i = 0; i < indices.size(); ++i) {
+            ASSERT_EQ(out[i], src[indices[i]]) << "level " << level << " at " << i;
+        }
+    }
+}
+
+template<typename T>
+static my_vector<T> iota_vector(size_t n) {
+    my_vector<T> v;
+    for (size_t i = 0; i < n; ++i) {
+        v.push_back(static_cast<T>(i * 3 + 1));
+    }
+    return v;
+}
+
+static my_vector<uint32_t> random_indices(size_t n, size_t limit, unsigned seed) {
+    std::mt19937 rng(seed);
+    my_vector<uint32_t> indices;
+    for (size_t i = 0; i < n; ++i) {
+        indices.push_back(rng() % limit);
+    }
+    return indices;
+}
+
+TEST(gatherTests, GatherEveryLevelAndType) {
+    my_vector<uint32_t> indices = random_indices(1003, 777, 1);
+    check_all_levels(iota_vector<int32_t>(777), indices);
+    check_all_levels(iota_vector<float>(777), indices);
+    check_all_levels(iota_vector<uint64_t>(777), indices);
+    check_all_levels(iota_vector<double>(777), indices);
+    check_all_levels(iota_vector<uint16_t>(777), indices);
+}
+
+TEST(gatherTests, GatherFromVectorAndArray) {
+    my_vector<int> src{10, 20, 30, 40, 50};
+    my_array<uint32_t, 4> indices{4, 0, 0, 2};
+    my_vector<int> expected{50, 10, 10, 30};
+    EXPECT_EQ(my_gather(src, indices), expected);
+
+    my_array<double, 3> arr{1.5, 2.5, 3.5};
+    my_vector<uint64_t> wide{2, 1};
+    my_vector<double> picked = my_gather(arr, wide);
+    EXPECT_EQ(picked.size(), 2);
+    EXPECT_EQ(picked[0], 3.5);
+    EXPECT_EQ(picked[1], 2.5);
+
+    my_vector<std::string> words{"a", "b", "c"};
+    my_vector<int> signed_indices{2, 2, 0};
+    my_vector<std::string> chosen = my_gather(words, signed_indices);
+    EXPECT_EQ(chosen[0], "c");
+    EXPECT_EQ(chosen[2], "a");
+}
+
+TEST(gatherTests, GatherLargeSourcePrefetches) {
+    my_vector<uint64_t> src = iota_vector<uint64_t>(size_t(1) << 20);
+    my_vector<uint32_t> indices = random_indices(5000, src.size(), 2);
+    check_all_levels(src, indices);
+    my_vector<uint64_t> out = my_gather(src, indices);
+    EXPECT_EQ(out.size(), indices.size());
+    EXPECT_EQ(out[4999], src[indices[4999]]);
+}
+
+TEST(gatherTests, OutOfRangeThrows) {
+    my_vector<int> src{1, 2, 3};
+    my_vector<uint32_t> bad{0, 3};
+    EXPECT_THROW(my_gather(src, bad), std::out_of_range);
+    my_vector<int> negative{0, -1};
+    EXPECT_THROW(my_gather(src, negative), std::out_of_range);
+    my_vector<int> values{7, 8};
+    EXPECT_THROW(my_scatter(src, bad, values), std::out_of_range);
+    my_vector<uint32_t> good{0, 1, 2};
+    EXPECT_THROW(my_scatter(src, good, values), std::invalid_argument);
+    EXPECT_TRUE(my_gather(src, my_vector<uint32_t>()).is_empty());
+}
+
+TEST(gatherTests, ScatterEveryLevel) {
+    my_vector<uint32_t> indices = random_indices(517, 300, 3);
+    my_vector<int64_t> values = iota_vector<int64_t>(indices.size());
+    for (int level = 0; level <= static_cast<int>(my_detect_simd_level()); ++level) {
+        my_vector<int64_t> dst(300, int64_t(-1));
+        my_scatter_unchecked(dst.begin(), dst.size(), indices.cbegin(), indices.size(), values.cbegin(),
+                             static_cast<my_simd_level>(level));
+        my_vector<int64_t> expected(300, int64_t(-1));
+        for (size_t i = 0; i < indices.size(); ++i) {
+            expected[indices[i]] = values[i];
+        }
+        EXPECT_EQ(dst, expected) << "level " << level;
+    }
+}
+
+TEST(gatherTests, ScatterRepeatedIndexLastWins) {
+    my_vector<float> dst(4, 0.0f);
+    my_vector<uint32_t> indices;
+    my_vector<float> values;
+    for (int i = 0; i < 32; ++i) {
+        indices.push_back(i % 2);
+        values.push_back(static_cast<float>(i));
+    }
+    my_scatter(dst, indices, values);
+    EXPECT_EQ(dst[0], 30.0f);
+    EXPECT_EQ(dst[1], 31.0f);
+    EXPECT_EQ(dst[2], 0.0f);
+
+    my_array<int, 3> arr{0, 0, 0};
+    my_scatter(arr, my_vector<uint32_t>{2}, my_vector<int>{9});
+    EXPECT_EQ(arr[2], 9);
+    my_scatter(my_span<int>(arr), my_vector<uint32_t>{0}, my_vector<int>{5});
+    EXPECT_EQ(arr[0], 5);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "my_hash.hpp"
+
+
+TEST(hashTests, EqualContentsEqualHash) {
+    my_vector<uint8_t> a{1, 2, 3, 4, 5};
+    my_vector<uint8_t> b{1, 2, 3, 4, 5};
+    b.reserve(100);
+    EXPECT_EQ(std::hash<my_vector<uint8_t>>()(a), std::hash<my_vector<uint8_t>>()(b));
+    b[4] = 6;
+    EXPECT_NE(std::hash<my_vector<uint8_t>>()(a), std::hash<my_vector<uint8_t>>()(b));
+}
+
+TEST(hashTests, EveryLengthIsDistinct) {
+    std::set<size_t> seen;
+    my_vector<uint8_t> bytes;
+    for (int len = 0; len < 200; ++len) {
+        seen.insert(std::hash<my_vector<uint8_t>>()(bytes));
+        bytes.push_back(0);
+    }
+    EXPECT_EQ(seen.size(), 200);
+}
+
+TEST(hashTests, SingleBitChangesHash) {
+    my_vector<uint64_t> words;
+    for (uint64_t i = 0; i < 20; ++i) {
+        words.push_back(i * 0x9e3779b97f4a7c15ull);
+    }
+    size_t base = std::hash<my_vector<uint64_t>>()(words);
+    std::set<size_t> seen{base};
+    for (size_t i = 0; i < words.size(); ++i) {
+        words[i] ^= 1;
+        seen.insert(std::hash<my_vector<uint64_t>>()(words));
+        words[i] ^= 1;
+    }
+    EXPECT_EQ(seen.size(), words.size() + 1);
+    EXPECT_EQ(std::hash<my_vector<uint64_t>>()(words), base);
+}
+
+TEST(hashTests, ElementwiseFallback) {
+    my_vector<std::string> a{"dedup", "cache"};
+    my_vector<std::string> b{"dedup", "cache"};
+    EXPECT_EQ(std::hash<my_vector<std::string>>()(a), std::hash<my_vector<std::string>>()(b));
+    my_vector<double> zeros{0.0};
+    my_vector<double> negative_zeros{-0.0};
+    EXPECT_EQ(std::hash<my_vector<double>>()(zeros), std::hash<my_vector<double>>()(negative_zeros));
+}
+
+TEST(hashTests, ArrayHash) {
+    my_array<int, 4> a{1, 2, 3, 4};
+    my_array<int, 4> b{1, 2, 3, 4};
+    my_array<int, 4> c{4, 3, 2, 1};
+    std::hash<my_array<int, 4>> hasher;
+    EXPECT_EQ(hasher(a), hasher(b));
+    EXPECT_NE(hasher(a), hasher(c));
+}
+
+TEST(hashTests, UnorderedSetKeys) {
+    std::unordered_set<my_vector<uint8_t>> set;
+    set.insert(my_vector<uint8_t>{1, 2});
+    set.insert(my_vector<uint8_t>{1, 2});
+    set.insert(my_vector<uint8_t>{2, 1});
+    EXPECT_EQ(set.size(), 2);
+    EXPECT_EQ(set.count(my_vector<uint8_t>{2, 1}), 1);
+}
+
+TEST(hashTests, CachedHashInvalidatesOnMutation) {
+    my_hashed<my_vector<uint8_t>> key(my_vector<uint8_t>{7, 8, 9});
+    EXPECT_FALSE(key.has_cached_hash());
+    size_t first = key.hash();
+    EXPECT_TRUE(key.has_cached_hash());
+    EXPECT_EQ(first, std::hash<my_vector<uint8_t>>()(key.get()));
+
+    key.mutate().push_back(10);
+    EXPECT_FALSE(key.has_cached_hash());
+    EXPECT_NE(key.hash(), first);
+
+    key.modify([](my_vector<uint8_t> &v) { v.pop_back(); });
+    EXPECT_EQ(key.hash(), first);
+
+    std::unordered_set<my_hashed<my_vector<uint8_t>>> set;
+    set.insert(key);
+    EXPECT_EQ(set.count(my_hashed<my_vector<uint8_t>>(my_vector<uint8_t>{7, 8, 9})), 1);
+}
+
+TEST(hashTests, CachedHashSharedAcrossThreads) {
+    my_vector<uint8_t> bytes(4096, uint8_t(3));
+    const my_hashed<my_vector<uint8_t>> key(bytes);
+    const my_hashed<my_vector<uint8_t>> same(bytes);
+    size_t expected = std::hash<my_vector<uint8_t>>()(bytes);
+    std::vector<std::thread> readers;
+    std::vector<int> mismatches(4, 0);
+    for (size_t t = 0; t < 4; ++t) {
+        readers.emplace_back([&key, &same, &mismatches, expected, t]() {
+            for (int i = 0; i < 100; ++i) {
+                if (key.hash() != expected || !(key == same)) {
+                    ++mismatches[t];
+                }
+            }
+        });
+    }
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    for (int count : mismatches) {
+        EXPECT_EQ(count, 0);
+    }
+
+    my_hashed<my_vector<uint8_t>> copy = key;
+    EXPECT_TRUE(copy.has_cached_hash());
+    EXPECT_EQ(copy.hash(), expected);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "my_inplace_vector.hpp"
+
+static size_t allocation_count = 0;
+
+void* operator new(size_t size) {
+    ++allocation_count;
+    if (void* result = std::malloc(size ? size : 1)) {
+        return result;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+struct counted {
+    static inline int alive = 0;
+    int value;
+
+    counted(int v = 0) : value(v) { ++alive; }
+    counted(const counted &other) : value(other.value) { ++alive; }
+    counted &operator=(const counted &other)=default;
+    ~counted() { --alive; }
+
+    friend bool operator==(const counted &lhs, const counted &rhs) { return lhs.value == rhs.value; }
+};
+
+
+TEST(inplaceVectorTests, OnlyLiveElementsAreConstructed) {
+    counted::alive = 0;
+    {
+        my_inplace_vector<counted, 16> v;
+        EXPECT_EQ(counted::alive, 0);
+        v.push_back(counted(1));
+        v.emplace_back(2);
+        EXPECT_EQ(counted::alive, 2);
+        v.pop_back();
+        EXPECT_EQ(counted::alive, 1);
+    }
+    EXPECT_EQ(counted::alive, 0);
+}
+
+TEST(inplaceVectorTests, NeverAllocates) {
+    size_t before = allocation_count;
+    my_inplace_vector<int, 8> v{1, 2, 3};
+    v.push_back(4);
+    v.insert(v.begin(), 0);
+    int more[] = {7, 8};
+    v.insert(v.begin() + 2, more, more + 2);
+    v.erase(1);
+    v.erase(v.begin(), v.begin() + 1);
+    my_inplace_vector<int, 8> copy = v;
+    copy.resize(8, 9);
+    EXPECT_EQ(allocation_count, before);
+}
+
+TEST(inplaceVectorTests, InsertAndErase) {
+    my_inplace_vector<std::string, 8> v{"a", "d"};
+    v.insert(v.begin() + 1, "b");
+    std::string more[] = {"c", "x", "y"};
+    v.insert(v.begin() + 2, more, more + 1);
+    v.insert(v.end(), more + 1, more + 3);
+    my_inplace_vector<std::string, 8> expected{"a", "b", "c", "d", "x", "y"};
+    EXPECT_EQ(v, expected);
+
+    auto it = v.erase(0);
+    EXPECT_EQ(*it, "b");
+    v.erase(v.begin() + 3, v.end());
+    my_inplace_vector<std::string, 8> trimmed{"b", "c", "d"};
+    EXPECT_EQ(v, trimmed);
+
+    // empty ranges must leave the elements alone (self-move empties strings)
+    v.erase(v.begin() + 1, v.begin() + 1);
+    EXPECT_EQ(v, trimmed);
+    v.insert(v.begin() + 1, more, more);
+    EXPECT_EQ(v, trimmed);
+}
+
+TEST(inplaceVectorTests, CapacityExceeded) {
+    my_inplace_vector<int, 2> v{1, 2};
+    EXPECT_TRUE(v.is_full());
+    EXPECT_THROW(v.push_back(3), std::length_error);
+    EXPECT_THROW(v.insert(v.begin(), 0), std::length_error);
+    EXPECT_FALSE(v.try_push_back(3));
+    EXPECT_THROW((my_inplace_vector<int, 2>{1, 2, 3}), std::length_error);
+    EXPECT_THROW(v.at(2), std::out_of_range);
+    EXPECT_EQ(v.size(), 2);
+}
+
+TEST(inplaceVectorTests, CopyMoveAndSwap) {
+    my_inplace_vector<std::string, 4> a{"one", "two", "three"};
+    my_inplace_vector<std::string, 4> b{"x"};
+    a.swap(b);
+    EXPECT_EQ(a.size(), 1);
+    EXPECT_EQ(b.size(), 3);
+    EXPECT_EQ(a[0], "x");
+    EXPECT_EQ(b[2], "three");
+
+    my_inplace_vector<std::string, 4> c = std::move(b);
+    EXPECT_TRUE(b.is_empty());
+    EXPECT_EQ(c.back(), "three");
+    a = c;
+    EXPECT_EQ(a, c);
+    b = std::move(a);
+    EXPECT_EQ(b, c);
+}
+
+TEST(inplaceVectorTests, Resize) {
+    my_inplace_vector<int, 10> v{1, 2, 3};
+    v.resize(6, 4);
+    EXPECT_EQ(v.size(), 6);
+    EXPECT_EQ(v[5], 4);
+    v.resize(2);
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_THROW(v.resize(11), std::length_error);
+    v.clear();
+    EXPECT_TRUE(v.is_empty());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
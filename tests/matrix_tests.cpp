@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "my_matrix.hpp"
+
+template<typename Matrix>
+static void fill_sequence(Matrix &m) {
+    for (size_t r = 0; r < m.rows(); ++r) {
+        for (size_t c = 0; c < m.cols(); ++c) {
+            m(r, c) = static_cast<int>(r * 1000 + c);
+        }
+    }
+}
+
+
+TEST(matrixTests, NdarrayShapeAndIndexing) {
+    using cube = my_ndarray<int, 2, 3, 4>;
+    static_assert(cube::rank == 3);
+    static_assert(cube::size() == 24);
+    static_assert(cube::stride(0) == 12 && cube::stride(1) == 4 && cube::stride(2) == 1);
+    static_assert(cube::offset(1, 2, 3) == 23);
+    EXPECT_EQ(cube::extent(1), 3);
+
+    cube a(0);
+    a(1, 0, 2) = 7;
+    EXPECT_EQ(a[12 + 2], 7);
+    EXPECT_EQ(a.at(1, 0, 2), 7);
+    EXPECT_THROW(a.at(2, 0, 0), std::out_of_range);
+    EXPECT_THROW(a.at(0, 0, 4), std::out_of_range);
+    EXPECT_EQ(a.flat().size(), 24);
+
+    my_ndarray<int, 2, 2> small{1, 2, 3};
+    EXPECT_EQ(small(1, 0), 3);
+    EXPECT_EQ(small(1, 1), 0);
+    EXPECT_THROW((my_ndarray<int, 2, 2>{1, 2, 3, 4, 5}), std::invalid_argument);
+}
+
+TEST(matrixTests, NdarrayMatrixView) {
+    my_ndarray<int, 2, 3> a{1, 2, 3, 4, 5, 6};
+    my_matrix_view<int> v = a.view();
+    EXPECT_EQ(v(1, 2), 6);
+    my_matrix_view<int> t = v.transposed();
+    EXPECT_EQ(t.rows(), 3);
+    EXPECT_EQ(t(2, 1), 6);
+    EXPECT_EQ(t(0, 1), 4);
+    t(1, 0) = 20;
+    EXPECT_EQ(a(0, 1), 20);
+    my_matrix_view<const int> ct = t;
+    EXPECT_EQ(ct.at(1, 0), 20);
+    EXPECT_THROW(ct.at(3, 0), std::out_of_range);
+}
+
+TEST(matrixTests, StridedViews) {
+    my_matrix<int> m(6, 8);
+    fill_sequence(m);
+    my_matrix_view<int> v = m.view();
+    my_matrix_view<int> sub = v.block(1, 2, 3, 4);
+    EXPECT_EQ(sub(0, 0), 1002);
+    EXPECT_EQ(sub(2, 3), 3005);
+    my_matrix_view<int> every_other = v.strided(2, 3);
+    EXPECT_EQ(every_other.rows(), 3);
+    EXPECT_EQ(every_other.cols(), 3);
+    EXPECT_EQ(every_other(2, 2), 4006);
+    my_matrix_view<int> col = v.column(5);
+    EXPECT_EQ(col.rows(), 6);
+    EXPECT_EQ(col(4, 0), 4005);
+    EXPECT_EQ(v.row(3)(0, 7), 3007);
+    EXPECT_THROW(v.block(5, 0, 2, 1), std::out_of_range);
+    EXPECT_THROW(v.strided(0, 1), std::invalid_argument);
+}
+
+TEST(matrixTests, BlockedCopyAndTranspose) {
+    my_matrix<int> m(37, 53);
+    fill_sequence(m);
+    my_matrix<int> t(53, 37);
+    my_blocked_transpose(m.view(), t.view(), 8);
+    for (size_t r = 0; r < 53; ++r) {
+        for (size_t c = 0; c < 37; ++c) {
+            ASSERT_EQ(t(r, c), m(c, r));
+        }
+    }
+    EXPECT_EQ(m.transposed(), t);
+    EXPECT_EQ(t.transposed(), m);
+
+    my_matrix<int> part(10, 20);
+    my_blocked_copy(m.view().block(5, 5, 10, 20), part.view());
+    EXPECT_EQ(part(9, 19), 14024);
+    EXPECT_THROW(my_blocked_copy(m.view(), part.view()), std::invalid_argument);
+}
+
+TEST(matrixTests, TiledLayout) {
+    using tiled = my_matrix<int, my_matrix_layout::tiled, 4>;
+    tiled m(6, 9);
+    fill_sequence(m);
+    EXPECT_EQ(m.storage().size(), 8 * 12);
+    // (0, 3) and (1, 0) are neighbours inside the first 4 x 4 tile
+    EXPECT_EQ(&m(1, 0) - &m(0, 3), 1);
+    EXPECT_EQ(&m(0, 4) - &m(0, 0), 16);
+    EXPECT_EQ(m.at(5, 8), 5008);
+    EXPECT_THROW(m.at(6, 0), std::out_of_range);
+
+    tiled t = m.transposed();
+    EXPECT_EQ(t.rows(), 9);
+    EXPECT_EQ(t.cols(), 6);
+    for (size_t r = 0; r < 9; ++r) {
+        for (size_t c = 0; c < 6; ++c) {
+            ASSERT_EQ(t(r, c), m(c, r));
+        }
+    }
+    EXPECT_EQ(t.transposed(), m);
+}
+
+TEST(matrixTests, LayoutConversionRoundTrip) {
+    my_matrix<double> row_major(5, 7, {
+        1, 2, 3, 4, 5, 6, 7,
+        8, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21,
+        22, 23, 24, 25, 26, 27, 28,
+        29, 30, 31, 32, 33, 34, 35});
+    EXPECT_EQ(row_major.row(2)[3], 18);
+    my_matrix<double, my_matrix_layout::tiled, 2> tiled(row_major);
+    EXPECT_EQ(tiled(4, 6), 35);
+    my_matrix<double> back(tiled);
+    EXPECT_EQ(back, row_major);
+    EXPECT_THROW(my_matrix<double>(2, 2, {1, 2, 3}), std::invalid_argument);
+
+    my_matrix<uint8_t> filled(3, 3, 9);
+    EXPECT_EQ(filled(2, 2), 9);
+    EXPECT_EQ((my_matrix<uint8_t>(3, 3, {9})), filled);
+    my_matrix<int, my_matrix_layout::tiled, 2> braced(3, 5, {4});
+    EXPECT_EQ(braced(2, 4), 4);
+    EXPECT_EQ(braced(0, 0), 4);
+    filled.fill(1);
+    EXPECT_EQ(filled(0, 1), 1);
+    EXPECT_TRUE(my_matrix<int>().is_empty());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
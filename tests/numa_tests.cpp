@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "my_numa.hpp"
+
+
+TEST(numaTests, ParseList) {
+    my_vector<int> cpus = my_numa_parse_list("0-3,8,10-11\n");
+    my_vector<int> expected{0, 1, 2, 3, 8, 10, 11};
+    EXPECT_EQ(cpus, expected);
+    EXPECT_TRUE(my_numa_parse_list("").is_empty());
+}
+
+TEST(numaTests, TopologyHasAtLeastOneNode) {
+    my_numa_topology topology;
+    EXPECT_GE(topology.node_count(), 1);
+    EXPECT_GE(topology.node_id(0), 0);
+}
+
+TEST(numaTests, DefaultThreadsFollowNodeCpus) {
+    my_numa_topology topology;
+    size_t cpus = 0;
+    for (size_t i = 0; i < topology.node_count(); ++i) {
+        cpus += topology.cpus(i).size();
+    }
+    my_vector<size_t> nodes = my_numa_thread_nodes(topology, my_numa_options());
+    EXPECT_EQ(nodes.size(), cpus != 0 ? cpus : std::max(1u, std::thread::hardware_concurrency()));
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        EXPECT_LE(nodes[i - 1], nodes[i]);
+    }
+
+    my_numa_options options;
+    options.threads_per_node = 3;
+    EXPECT_EQ(my_numa_thread_nodes(topology, options).size(), 3 * topology.node_count());
+}
+
+TEST(numaTests, SmallFillsStayOnOneThread) {
+    my_numa_options options;
+    EXPECT_EQ(my_numa_thread_count(400, 64, options), 1);
+    EXPECT_EQ(my_numa_thread_count(size_t(3) << 20, 64, options), 3);
+    EXPECT_EQ(my_numa_thread_count(size_t(1) << 30, 8, options), 8);
+    options.min_bytes_per_thread = 0;
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    EXPECT_EQ(my_numa_thread_count(10 * page, 64, options), 10);
+
+    my_numa_topology topology;
+    my_vector<int> v;
+    my_numa_resize(v, 100, 5, topology);
+    my_numa_resize(v, 200000, 6, topology, options);
+    EXPECT_EQ(v[99], 5);
+    EXPECT_EQ(v[100], 6);
+    EXPECT_EQ(v[199999], 6);
+}
+
+TEST(numaTests, FirstTouchResizeFillsValues) {
+    my_vector<uint64_t> v{1, 2};
+    my_numa_options options;
+    options.threads_per_node = 4;
+    my_numa_resize(v, 1 << 20, uint64_t(7), options);
+    EXPECT_EQ(v.size(), size_t(1) << 20);
+    EXPECT_EQ(v.capacity(), size_t(1) << 20);
+    EXPECT_EQ(v[0], 1);
+    EXPECT_EQ(v[1], 2);
+    for (size_t i = 2; i < v.size(); ++i) {
+        ASSERT_EQ(v[i], 7);
+    }
+}
+
+TEST(numaTests, InterleaveResizeFillsValues) {
+    my_vector<int> v;
+    my_numa_options options;
+    options.policy = my_numa_policy::interleave;
+    my_numa_resize(v, 300000, -1, options);
+    EXPECT_EQ(v.size(), 300000);
+    for (size_t i = 0; i < v.size(); ++i) {
+        ASSERT_EQ(v[i], -1);
+    }
+}
+
+TEST(numaTests, ResizeWithShrinks) {
+    my_vector<int> v{1, 2, 3};
+    my_numa_resize(v, 1, 0);
+    EXPECT_EQ(v.size(), 1);
+    EXPECT_EQ(v[0], 1);
+}
+
+TEST(numaTests, PlacementReportCoversEveryPage) {
+    my_vector<uint8_t> v;
+    my_numa_resize(v, 1 << 22, uint8_t(1));
+    my_numa_placement placement = my_numa_page_placement(v);
+    size_t total = placement.unknown_pages;
+    for (size_t i = 0; i < placement.pages_per_node.size(); ++i) {
+        total += placement.pages_per_node[i];
+    }
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t first_page = reinterpret_cast<uintptr_t>(v.cbegin()) / page;
+    size_t last_page = (reinterpret_cast<uintptr_t>(v.cend()) - 1) / page;
+    EXPECT_EQ(total, last_page - first_page + 1);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
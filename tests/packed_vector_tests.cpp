@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "my_packed_vector.hpp"
+
+
+TEST(packedVectorTests, ExplicitWidth) {
+    my_packed_vector<uint32_t> v(5);
+    EXPECT_EQ(v.bit_width(), 5);
+    for (uint32_t i = 0; i < 32; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(v.size(), 32);
+    for (uint32_t i = 0; i < 32; ++i) {
+        EXPECT_EQ(v[i], i);
+    }
+    EXPECT_THROW(v.push_back(32), std::invalid_argument);
+    EXPECT_THROW((void) v.at(32), std::out_of_range);
+    EXPECT_THROW(my_packed_vector<uint32_t>(33), std::invalid_argument);
+}
+
+TEST(packedVectorTests, AutomaticWidth) {
+    my_vector<uint64_t> ids{3, 1000, 17, 0, 1023};
+    my_packed_vector<uint64_t> packed{my_span<const uint64_t>(ids)};
+    EXPECT_EQ(packed.bit_width(), 10);
+    EXPECT_EQ(packed.size(), ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        EXPECT_EQ(packed[i], ids[i]);
+    }
+    EXPECT_EQ(packed.front(), 3);
+    EXPECT_EQ(packed.back(), 1023);
+}
+
+TEST(packedVectorTests, SetKeepsNeighbours) {
+    my_packed_vector<uint64_t> v(13);
+    for (int i = 0; i < 20; ++i) {
+        v.push_back(8191);
+    }
+    v.set(4, 0);
+    v.set(9, 1234);
+    for (size_t i = 0; i < 20; ++i) {
+        uint64_t expected = i == 4 ? 0 : (i == 9 ? 1234 : 8191);
+        EXPECT_EQ(v[i], expected);
+    }
+    v.pop_back();
+    EXPECT_EQ(v.size(), 19);
+}
+
+TEST(packedVectorTests, RoundTripEveryWidth64) {
+    std::mt19937_64 rng(42);
+    for (unsigned width = 1; width <= 64; ++width) {
+        uint64_t mask = width == 64 ? ~uint64_t(0) : (uint64_t(1) << width) - 1;
+        std::vector<uint64_t> values(77);
+        my_packed_vector<uint64_t> packed(width);
+        for (auto &value : values) {
+            value = rng() & mask;
+            packed.push_back(value);
+        }
+        my_vector<uint64_t> decoded = packed.to_vector();
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(packed[i], values[i]) << "width " << width;
+            ASSERT_EQ(decoded[i], values[i]) << "width " << width;
+        }
+    }
+}
+
+TEST(packedVectorTests, RoundTripEveryWidth32) {
+    std::mt19937 rng(7);
+    for (unsigned width = 1; width <= 32; ++width) {
+        uint32_t mask = width == 32 ? ~uint32_t(0) : (uint32_t(1) << width) - 1;
+        std::vector<uint32_t> values(53);
+        my_packed_vector<uint32_t> packed(width);
+        for (auto &value : values) {
+            value = rng() & mask;
+            packed.push_back(value);
+        }
+        my_vector<uint32_t> decoded = packed.to_vector();
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(decoded[i], values[i]) << "width " << width;
+        }
+    }
+}
+
+TEST(packedVectorTests, DecodeSubrange) {
+    my_packed_vector<uint32_t> v(7);
+    for (uint32_t i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    uint32_t out[20];
+    v.decode(33, my_span<uint32_t>(out));
+    for (uint32_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(out[i], 33 + i);
+    }
+    EXPECT_THROW(v.decode(90, my_span<uint32_t>(out)), std::out_of_range);
+}
+
+template<typename UInt>
+static void check_avx2_decode(my_simd_level level = my_simd_level::avx2) {
+    std::mt19937_64 rng(11);
+    for (unsigned width = 1; width <= 25; ++width) {
+        my_packed_vector<UInt> v(width);
+        for (int i = 0; i < 333; ++i) {
+            v.push_back(static_cast<UInt>(rng() & ((uint64_t(1) << width) - 1)));
+        }
+        for (size_t first : {size_t(0), size_t(1), size_t(7), size_t(50)}) {
+            my_vector<UInt> simd;
+            simd.resize(v.size() - first);
+            v.decode(first, my_span<UInt>(simd), level);
+            for (size_t i = 0; i < simd.size(); ++i) {
+                ASSERT_EQ(simd[i], v[first + i]) << "width " << width << " first " << first << " at " << i;
+            }
+        }
+    }
+}
+
+TEST(packedVectorTests, Avx2DecodeMatchesScalar) {
+    if (my_detect_simd_level() < my_simd_level::avx2) {
+        GTEST_SKIP() << "AVX2 is not available";
+    }
+    check_avx2_decode<uint32_t>();
+    check_avx2_decode<uint64_t>();
+}
+
+TEST(packedVectorTests, DecodeClampsSimdLevel) {
+    // asking for more than the CPU has falls back instead of faulting
+    check_avx2_decode<uint32_t>(my_simd_level::avx512);
+}
+
+TEST(packedVectorTests, UsesLessMemory) {
+    my_packed_vector<uint64_t> v(12);
+    for (uint64_t i = 0; i < 1024; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_LE(v.size_bytes(), 1024 * 12 / 8 + 8);
+    v.clear();
+    EXPECT_TRUE(v.is_empty());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include "my_ring_buffer.hpp"
+
+
+TEST(ringBufferTests, PushPopFifo) {
+    my_ring_buffer<int, 4> rb;
+    EXPECT_TRUE(rb.is_empty());
+    EXPECT_EQ(rb.capacity(), 4);
+    EXPECT_TRUE(rb.push(1));
+    EXPECT_TRUE(rb.push(2));
+    EXPECT_TRUE(rb.push(3));
+    EXPECT_TRUE(rb.push(4));
+    EXPECT_TRUE(rb.is_full());
+    EXPECT_FALSE(rb.push(5));
+    EXPECT_EQ(rb.front(), 1);
+    EXPECT_EQ(rb.back(), 4);
+
+    int value = 0;
+    EXPECT_TRUE(rb.pop(value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(rb.push(5));
+    EXPECT_EQ(rb[0], 2);
+    EXPECT_EQ(rb[3], 5);
+    EXPECT_THROW(rb.at(4), std::out_of_range);
+}
+
+TEST(ringBufferTests, WrapsAround) {
+    my_ring_buffer<std::string, 2> rb;
+    std::string out;
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(rb.push(std::to_string(i)));
+        EXPECT_TRUE(rb.pop(out));
+        EXPECT_EQ(out, std::to_string(i));
+    }
+    EXPECT_FALSE(rb.pop(out));
+}
+
+TEST(ringBufferTests, BulkPushPop) {
+    my_ring_buffer<int, 8> rb;
+    int first[] = {1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(rb.push(my_span<const int>(first)), 6);
+    int out[4];
+    EXPECT_EQ(rb.pop(my_span<int>(out)), 4);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[3], 4);
+
+    int second[] = {7, 8, 9, 10, 11, 12, 13};
+    EXPECT_EQ(rb.push(my_span<const int>(second)), 6);
+    EXPECT_TRUE(rb.is_full());
+    int all[8];
+    EXPECT_EQ(rb.pop(my_span<int>(all)), 8);
+    int expected[] = {5, 6, 7, 8, 9, 10, 11, 12};
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(all[i], expected[i]);
+    }
+    EXPECT_TRUE(rb.is_empty());
+}
+
+TEST(spscQueueTests, SingleThread) {
+    my_spsc_queue<int, 4> q;
+    EXPECT_TRUE(q.is_empty());
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(q.try_push(i));
+    }
+    EXPECT_FALSE(q.try_push(4));
+    EXPECT_EQ(q.size(), 4);
+    int value = -1;
+    EXPECT_TRUE(q.try_pop(value));
+    EXPECT_EQ(value, 0);
+    int batch[] = {10, 11};
+    EXPECT_EQ(q.try_push(my_span<const int>(batch)), 1);
+    int out[8];
+    EXPECT_EQ(q.try_pop(my_span<int>(out)), 4);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[3], 10);
+    EXPECT_FALSE(q.try_pop(value));
+}
+
+TEST(spscQueueTests, ProducerConsumerThreads) {
+    constexpr int total = 200000;
+    my_spsc_queue<int, 64> q;
+    std::thread producer([&q]() {
+        for (int i = 0; i < total; ++i) {
+            while (!q.try_push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    long long sum = 0;
+    int expected = 0;
+    bool in_order = true;
+    while (expected < total) {
+        int value;
+        if (q.try_pop(value)) {
+            in_order = in_order && value == expected;
+            sum += value;
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(sum, static_cast<long long>(total) * (total - 1) / 2);
+}
+
+TEST(spscQueueTests, SizeStaysInRangeWhileBusy) {
+    constexpr int total = 20000;
+    my_spsc_queue<int, 8> q;
+    std::atomic<bool> done(false);
+    size_t largest = 0;
+    std::thread observer([&q, &done, &largest]() {
+        while (!done.load()) {
+            largest = std::max(largest, q.size());
+            std::this_thread::yield();
+        }
+    });
+    std::thread producer([&q]() {
+        for (int i = 0; i < total; ++i) {
+            while (!q.try_push(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int popped = 0;
+    while (popped < total) {
+        int value;
+        if (q.try_pop(value)) {
+            ++popped;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    done.store(true);
+    observer.join();
+    EXPECT_LE(largest, q.capacity());
+    EXPECT_TRUE(q.is_empty());
+}
+
+TEST(spscQueueTests, IndicesOnSeparateCacheLines) {
+    using queue = my_spsc_queue<char, 2>;
+    EXPECT_GE(sizeof(queue), 3 * queue::cache_line);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
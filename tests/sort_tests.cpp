@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "my_sort.hpp"
+
+template<typename T>
+static bool matches_std_sort(my_vector<T> &v, const my_sort_policy &policy = my_sort_policy()) {
+    std::vector<T> expected(v.cbegin(), v.cend());
+    std::sort(expected.begin(), expected.end());
+    my_sort(v, policy);
+    return std::equal(v.cbegin(), v.cend(), expected.begin(), expected.end());
+}
+
+TEST(sortTests, RadixKeyPreservesOrder) {
+    EXPECT_LT(my_radix_key(-5), my_radix_key(3));
+    EXPECT_LT(my_radix_key(std::numeric_limits<int64_t>::min()), my_radix_key(int64_t(-1)));
+    EXPECT_LT(my_radix_key(-2.5f), my_radix_key(-1.0f));
+    EXPECT_LT(my_radix_key(-1.0), my_radix_key(0.0));
+    EXPECT_LT(my_radix_key(0.5), my_radix_key(2.0));
+}
+
+TEST(sortTests, UnsignedKeys) {
+    std::mt19937_64 rng(1);
+    my_vector<uint64_t> v;
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(rng());
+    }
+    EXPECT_TRUE(matches_std_sort(v));
+}
+
+TEST(sortTests, SignedKeys) {
+    std::mt19937 rng(2);
+    my_vector<int32_t> v;
+    for (int i = 0; i < 5000; ++i) {
+        v.push_back(static_cast<int32_t>(rng()));
+    }
+    v.push_back(std::numeric_limits<int32_t>::min());
+    v.push_back(std::numeric_limits<int32_t>::max());
+    EXPECT_TRUE(matches_std_sort(v));
+}
+
+TEST(sortTests, SmallBytesUseFewPasses) {
+    my_vector<int16_t> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(static_cast<int16_t>((i * 37) % 200 - 100));
+    }
+    EXPECT_TRUE(matches_std_sort(v));
+}
+
+TEST(sortTests, FloatingPointKeys) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> floats(-1000.0f, 1000.0f);
+    my_vector<float> f;
+    my_vector<double> d;
+    for (int i = 0; i < 3000; ++i) {
+        f.push_back(floats(rng));
+        d.push_back(floats(rng) * 1e10);
+    }
+    f.push_back(std::numeric_limits<float>::infinity());
+    f.push_back(-std::numeric_limits<float>::infinity());
+    EXPECT_TRUE(matches_std_sort(f));
+    EXPECT_TRUE(matches_std_sort(d));
+}
+
+TEST(sortTests, KeyExtractorIsStable) {
+    struct record {
+        uint32_t id;
+        int order;
+    };
+    my_vector<record> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(record{static_cast<uint32_t>(i % 7), i});
+    }
+    my_sort(v, [](const record &r) { return r.id; });
+    for (size_t i = 1; i < v.size(); ++i) {
+        ASSERT_LE(v[i - 1].id, v[i].id);
+        if (v[i - 1].id == v[i].id) {
+            ASSERT_LT(v[i - 1].order, v[i].order);
+        }
+    }
+}
+
+TEST(sortTests, ParallelRadix) {
+    std::mt19937_64 rng(4);
+    my_vector<uint32_t> v;
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(static_cast<uint32_t>(rng()));
+    }
+    my_sort_policy policy;
+    policy.threads = 3;
+    policy.parallel_threshold = 1000;
+    EXPECT_TRUE(matches_std_sort(v, policy));
+}
+
+TEST(sortTests, ParallelKeyExtractorIsStable) {
+    my_vector<std::pair<int, int>> v;
+    for (int i = 0; i < 20000; ++i) {
+        v.push_back({(i * 7919) % 13, i});
+    }
+    my_sort_policy policy;
+    policy.threads = 4;
+    policy.parallel_threshold = 1000;
+    my_sort(v, [](const std::pair<int, int> &p) { return p.first; }, policy);
+    for (size_t i = 1; i < v.size(); ++i) {
+        ASSERT_LE(v[i - 1].first, v[i].first);
+        if (v[i - 1].first == v[i].first) {
+            ASSERT_LT(v[i - 1].second, v[i].second);
+        }
+    }
+}
+
+TEST(sortTests, ArbitraryTypesFallBack) {
+    my_vector<std::string> v{"pear", "apple", "fig", "banana"};
+    EXPECT_TRUE(matches_std_sort(v));
+
+    my_vector<std::string> big;
+    for (int i = 0; i < 5000; ++i) {
+        big.push_back(std::to_string((i * 7919) % 5000));
+    }
+    my_sort_policy policy;
+    policy.threads = 4;
+    policy.parallel_threshold = 100;
+    EXPECT_TRUE(matches_std_sort(big, policy));
+}
+
+TEST(sortTests, EmptyAndSingle) {
+    my_vector<int> empty;
+    my_sort(empty);
+    EXPECT_TRUE(empty.is_empty());
+    my_vector<int> one{42};
+    my_sort(one);
+    EXPECT_EQ(one[0], 42);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "my_span.hpp"
+#include "my_vector.hpp"
+#include "my_array.hpp"
+#include "my_flat_map.hpp"
+
+
+static int sum(my_span<const int> items) {
+    int result = 0;
+    for (int value : items) {
+        result += value;
+    }
+    return result;
+}
+
+TEST(spanTests, FromVector) {
+    my_vector<int> v{1, 2, 3, 4};
+    my_span<int> s = v;
+    EXPECT_EQ(s.size(), 4);
+    EXPECT_EQ(s.data(), v.begin());
+    s[0] = 10;
+    EXPECT_EQ(v[0], 10);
+    EXPECT_EQ(sum(v), 19);
+}
+
+TEST(spanTests, FromArrayHasStaticExtent) {
+    my_array<int, 3> arr{1, 2, 3};
+    my_span s(arr);
+    static_assert(decltype(s)::extent == 3);
+    EXPECT_EQ(s.size(), 3);
+    EXPECT_EQ(sum(arr), 6);
+    my_span<int, 2> tail = s.last<2>();
+    EXPECT_EQ(tail[0], 2);
+    EXPECT_EQ(tail[1], 3);
+}
+
+TEST(spanTests, FirstLastSubspan) {
+    my_vector<int> v{0, 1, 2, 3, 4, 5};
+    my_span<int> s(v);
+    EXPECT_EQ(sum(s.first(2)), 1);
+    EXPECT_EQ(sum(s.last(2)), 9);
+    my_span<int> middle = s.subspan(1, 3);
+    EXPECT_EQ(middle.size(), 3);
+    EXPECT_EQ(middle.front(), 1);
+    EXPECT_EQ(middle.back(), 3);
+    EXPECT_EQ(s.subspan(4).size(), 2);
+    EXPECT_TRUE(s.subspan(6).is_empty());
+    EXPECT_EQ((s.subspan<2, 2>()[1]), 3);
+}
+
+TEST(spanTests, OutOfRange) {
+    my_vector<int> v{1, 2, 3};
+    my_span<int> s(v);
+    EXPECT_THROW(s.at(3), std::out_of_range);
+    EXPECT_THROW(s.first(4), std::out_of_range);
+    EXPECT_THROW(s.last(4), std::out_of_range);
+    EXPECT_THROW(s.subspan(4), std::out_of_range);
+    EXPECT_THROW(s.subspan(1, 3), std::out_of_range);
+}
+
+TEST(spanTests, ReverseIteration) {
+    int raw[] = {1, 2, 3};
+    my_span s(raw);
+    std::vector<int> result(s.rbegin(), s.rend());
+    std::vector<int> expected{3, 2, 1};
+    EXPECT_EQ(result, expected);
+}
+
+TEST(spanTests, VectorOverloads) {
+    my_vector<int> source{1, 2, 3, 4, 5};
+    my_vector<int> copy(my_span<const int>(source).subspan(1, 3));
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(copy[0], 2);
+    EXPECT_EQ(copy[2], 4);
+
+    my_vector<int> target{10, 20};
+    target.insert(target.begin() + 1, my_span<const int>(source).first(2));
+    EXPECT_EQ(target.size(), 4);
+    EXPECT_EQ(target[0], 10);
+    EXPECT_EQ(target[1], 1);
+    EXPECT_EQ(target[2], 2);
+    EXPECT_EQ(target[3], 20);
+}
+
+TEST(spanTests, FlatSetBulkInsert) {
+    my_array<int, 4> keys{4, 2, 4, 1};
+    my_flat_set<int> s;
+    s.insert(my_span<const int>(keys));
+    EXPECT_EQ(s.size(), 3);
+    EXPECT_EQ(s[0], 1);
+    EXPECT_EQ(s[2], 4);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "my_stream_loader.hpp"
+
+static std::string write_temp_file(const std::string &name, const std::string &contents) {
+    std::string path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream out(path, std::ios::binary);
+    out << contents;
+    return path;
+}
+
+// Appends every complete newline-terminated integer; a number cut off by
+// the chunk boundary is left unconsumed until the next chunk (or the end).
+static size_t parse_numbers(my_span<const char> text, bool last, my_vector<int64_t> &out) {
+    const char* pos = text.data();
+    const char* end = text.data() + text.size();
+    while (pos < end) {
+        const char* newline = std::find(pos, end, '\n');
+        if (newline == end && !last) {
+            break;
+        }
+        int64_t value = 0;
+        std::from_chars(pos, newline, value);
+        out.push_back(value);
+        pos = newline == end ? end : newline + 1;
+    }
+    return pos - text.data();
+}
+
+
+TEST(streamLoaderTests, ParsesAcrossChunkBoundaries) {
+    std::string contents;
+    for (int i = 0; i < 2000; ++i) {
+        contents += std::to_string(i * 37 - 5000) + "\n";
+    }
+    contents += "123456";
+    std::string path = write_temp_file("my_stream_numbers.txt", contents);
+    for (size_t chunk : {size_t(1), size_t(7), size_t(64), size_t(1) << 20}) {
+        my_stream_options options;
+        options.chunk_bytes = chunk;
+        options.bytes_per_element = 5;
+        my_vector<int64_t> values = my_load_parsed<int64_t>(path, parse_numbers, options);
+        ASSERT_EQ(values.size(), 2001) << "chunk " << chunk;
+        EXPECT_EQ(values[0], -5000);
+        EXPECT_EQ(values[1999], 1999 * 37 - 5000);
+        EXPECT_EQ(values[2000], 123456);
+        EXPECT_GE(values.capacity(), contents.size() / 5);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(streamLoaderTests, ChunksArriveInOrderWithCarry) {
+    std::string contents;
+    for (int i = 0; i < 10000; ++i) {
+        contents += static_cast<char>('a' + i % 26);
+    }
+    std::string path = write_temp_file("my_stream_letters.txt", contents);
+    my_stream_options options;
+    options.chunk_bytes = 100;
+    std::string seen;
+    size_t calls = 0;
+    size_t total = my_stream_chunks(path, [&](my_span<const char> chunk, bool last) -> size_t {
+        ++calls;
+        // keep the last 3 bytes for the next call, except at the end
+        size_t take = last ? chunk.size() : chunk.size() - std::min<size_t>(3, chunk.size());
+        seen.append(chunk.data(), take);
+        return take;
+    }, options);
+    EXPECT_EQ(total, contents.size());
+    EXPECT_EQ(seen, contents);
+    EXPECT_EQ(calls, 101);
+    std::filesystem::remove(path);
+}
+
+TEST(streamLoaderTests, TailLongerThanChunkIsKept) {
+    std::string contents = std::string(50, 'x') + "\n" + std::string(5, 'y') + "\n";
+    std::string path = write_temp_file("my_stream_long_line.txt", contents);
+    my_stream_options options;
+    options.chunk_bytes = 8;
+    my_vector<size_t> lengths;
+    my_stream_chunks(path, [&](my_span<const char> chunk, bool) -> size_t {
+        const char* newline = std::find(chunk.begin(), chunk.end(), '\n');
+        if (newline == chunk.end()) {
+            return 0;
+        }
+        lengths.push_back(newline - chunk.begin());
+        return newline - chunk.begin() + 1;
+    }, options);
+    ASSERT_EQ(lengths.size(), 2);
+    EXPECT_EQ(lengths[0], 50);
+    EXPECT_EQ(lengths[1], 5);
+    std::filesystem::remove(path);
+}
+
+TEST(streamLoaderTests, ErrorsPropagate) {
+    EXPECT_THROW(my_stream_chunks("/nonexistent/my_stream_file", [](my_span<const char>, bool) { return size_t(0); }),
+                 std::runtime_error);
+    std::string path = write_temp_file("my_stream_error.txt", std::string(1000, 'z'));
+    my_stream_options options;
+    options.chunk_bytes = 10;
+    int calls = 0;
+    EXPECT_THROW(my_stream_chunks(path, [&](my_span<const char> chunk, bool) -> size_t {
+        if (++calls == 3) {
+            throw std::logic_error("parse failed");
+        }
+        return chunk.size();
+    }, options), std::logic_error);
+    EXPECT_EQ(calls, 3);
+    std::filesystem::remove(path);
+}
+
+TEST(streamLoaderTests, LoadRecords) {
+    my_vector<uint32_t> records;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        records.push_back(i * i);
+    }
+    std::string bytes(reinterpret_cast<const char*>(records.cbegin()), records.size() * sizeof(uint32_t));
+    std::string path = write_temp_file("my_stream_records.bin", bytes);
+    my_vector<uint32_t> loaded = my_load_records<uint32_t>(path);
+    EXPECT_EQ(loaded, records);
+    EXPECT_EQ(loaded.capacity(), 1000);
+    std::string odd = write_temp_file("my_stream_odd.bin", "12345");
+    EXPECT_THROW(my_load_records<uint64_t>(odd), std::runtime_error);
+    std::string empty = write_temp_file("my_stream_empty.bin", "");
+    EXPECT_TRUE(my_load_records<uint64_t>(empty).is_empty());
+    std::filesystem::remove(path);
+    std::filesystem::remove(odd);
+    std::filesystem::remove(empty);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include "my_vector.hpp"
+
+
+TEST(vectorRecyclerTests, DisabledByDefault) {
+    EXPECT_FALSE(my_vector_recycler<int>::is_enabled());
+    my_vector<int> v;
+    v.reserve(100);
+    EXPECT_EQ(v.capacity(), 100);
+    EXPECT_EQ(my_vector_recycler<int>::stats().misses, 0);
+}
+
+TEST(vectorRecyclerTests, ReleasedBufferIsReused) {
+    my_vector_recycler<double>::enable();
+    my_vector_recycler<double>::reset_stats();
+    const double* first_buffer;
+    {
+        my_vector<double> v;
+        v.reserve(100);
+        EXPECT_EQ(v.capacity(), 128);
+        first_buffer = v.cbegin();
+    }
+    EXPECT_EQ(my_vector_recycler<double>::stats().cached_buffers, 1);
+    EXPECT_EQ(my_vector_recycler<double>::stats().cached_bytes, 128 * sizeof(double));
+    {
+        my_vector<double> w;
+        w.resize(70, 1.5);
+        EXPECT_EQ(w.capacity(), 256);
+        my_vector<double> u;
+        u.reserve(65);
+        EXPECT_EQ(u.cbegin(), first_buffer);
+        u.push_back(2.5);
+        EXPECT_EQ(u[0], 2.5);
+    }
+    my_recycler_stats stats = my_vector_recycler<double>::stats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.recycled, 3);
+    EXPECT_EQ(stats.cached_buffers, 2);
+    my_vector_recycler<double>::disable();
+    EXPECT_EQ(my_vector_recycler<double>::stats().cached_buffers, 0);
+    EXPECT_EQ(my_vector_recycler<double>::stats().cached_bytes, 0);
+}
+
+TEST(vectorRecyclerTests, SteadyStateAvoidsAllocations) {
+    my_vector_recycler<uint32_t>::enable();
+    for (int round = 0; round < 100; ++round) {
+        my_vector<uint32_t> v;
+        for (uint32_t i = 0; i < 1000; ++i) {
+            v.push_back(i);
+        }
+        my_vector<uint32_t> copy = v;
+        EXPECT_EQ(copy[999], 999);
+    }
+    my_recycler_stats stats = my_vector_recycler<uint32_t>::stats();
+    EXPECT_GT(stats.hits, 90 * 11);
+    EXPECT_LT(stats.misses, 20);
+    my_vector_recycler<uint32_t>::disable();
+}
+
+TEST(vectorRecyclerTests, ShrinkToFitIsExact) {
+    my_vector_recycler<int32_t>::enable();
+    my_vector<int32_t> v;
+    for (int32_t i = 0; i < 100; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_EQ(v.capacity(), 128);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 100);
+    const int32_t* buffer = v.cbegin();
+    v.shrink_to_fit();
+    EXPECT_EQ(v.cbegin(), buffer);
+    EXPECT_EQ(v[99], 99);
+    my_vector_recycler<int32_t>::disable();
+}
+
+TEST(vectorRecyclerTests, LimitsAndTrim) {
+    my_vector_recycler<char>::enable(1000);
+    my_vector_recycler<char>::reset_stats();
+    {
+        my_vector<my_vector<char>> many;
+        for (int i = 0; i < 12; ++i) {
+            my_vector<char> v;
+            v.reserve(16);
+            many.emplace_back(std::move(v));
+        }
+        my_vector<char> big;
+        big.reserve(2048);
+    }
+    my_recycler_stats stats = my_vector_recycler<char>::stats();
+    EXPECT_EQ(stats.cached_buffers, my_vector_recycler<char>::max_per_bucket);
+    EXPECT_EQ(stats.dropped, 12 - my_vector_recycler<char>::max_per_bucket + 1);
+    EXPECT_LE(stats.cached_bytes, 1000);
+
+    my_vector_recycler<char>::trim(40);
+    EXPECT_LE(my_vector_recycler<char>::stats().cached_bytes, 40);
+    my_vector_recycler<char>::disable();
+}
+
+TEST(vectorRecyclerTests, OtherThreadsAndTypesUnaffected) {
+    my_vector_recycler<int64_t>::enable();
+    bool enabled_elsewhere = true;
+    std::thread worker([&enabled_elsewhere]() {
+        enabled_elsewhere = my_vector_recycler<int64_t>::is_enabled();
+        my_vector<int64_t> v;
+        v.reserve(100);
+        EXPECT_EQ(v.capacity(), 100);
+    });
+    worker.join();
+    EXPECT_FALSE(enabled_elsewhere);
+
+    my_vector_recycler<std::string>::enable();
+    {
+        my_vector<std::string> words;
+        words.reserve(8);
+        words.push_back("kept alive");
+    }
+    EXPECT_EQ(my_vector_recycler<std::string>::stats().cached_buffers, 0);
+    my_vector_recycler<std::string>::disable();
+    my_vector_recycler<int64_t>::disable();
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <string>
 #include "my_vector.hpp"
 
 
@@ -282,6 +283,23 @@ TEST(vectorTests, EraseRangeBeginning) {
     EXPECT_EQ(*it, 15);
 }
 
+TEST(vectorTests, InsertEmptyRangeKeepsElements) {
+    my_vector<std::string> v{"a", "b", "c", "d"};
+    std::string p[] = {"x"};
+    auto it = v.insert(v.begin() + 1, p, p);
+    my_vector<std::string> expected{"a", "b", "c", "d"};
+    EXPECT_EQ(v, expected);
+    EXPECT_EQ(it, v.begin() + 1);
+}
+
+TEST(vectorTests, EraseEmptyRangeKeepsElements) {
+    my_vector<std::string> v{"a", "b", "c", "d"};
+    auto it = v.erase(v.begin() + 1, v.begin() + 1);
+    my_vector<std::string> expected{"a", "b", "c", "d"};
+    EXPECT_EQ(v, expected);
+    EXPECT_EQ(it, v.begin() + 1);
+}
+
 TEST(vectorTests, EraseRangeEnd) {
     my_vector<int> v{7, 14, 21, 28, 35};
     auto it = v.erase(v.begin() + 3, v.end());
@@ -406,6 +424,126 @@ TEST(vectorTests, GreaterThanOrEqual) {
     EXPECT_FALSE(a < b);
 }
 
+TEST(vectorTests, MoveConstructorStealsBuffer) {
+    my_vector<int> a{1, 2, 3};
+    int* buffer = a.begin();
+    my_vector<int> b(std::move(a));
+    EXPECT_EQ(b.begin(), buffer);
+    EXPECT_EQ(b.size(), 3);
+    EXPECT_EQ(a.size(), 0);
+    EXPECT_EQ(a.capacity(), 0);
+    static_assert(std::is_nothrow_move_constructible_v<my_vector<int>>);
+    static_assert(std::is_nothrow_move_assignable_v<my_vector<int>>);
+    static_assert(std::is_nothrow_swappable_v<my_vector<int>>);
+}
+
+TEST(vectorTests, MoveAssignment) {
+    my_vector<std::string> a{"a", "b"};
+    my_vector<std::string> b{"c"};
+    std::string* buffer = a.begin();
+    b = std::move(a);
+    EXPECT_EQ(b.begin(), buffer);
+    EXPECT_EQ(b.size(), 2);
+    EXPECT_EQ(b[1], "b");
+    EXPECT_TRUE(a.is_empty());
+}
+
+TEST(vectorTests, CopyAssignmentReusesBuffer) {
+    my_vector<int> a{1, 2, 3};
+    my_vector<int> b{9, 9, 9, 9, 9};
+    int* buffer = b.begin();
+    b = a;
+    EXPECT_EQ(b.begin(), buffer);
+    EXPECT_EQ(b, a);
+    EXPECT_EQ(b.capacity(), 10);
+}
+
+TEST(vectorTests, NestedVectorsMoveBuffers) {
+    my_vector<my_vector<int>> nested;
+    nested.push_back(my_vector<int>{3, 3, 3});
+    nested.push_back(my_vector<int>{1});
+    nested.push_back(my_vector<int>{2, 2});
+    int* inner = nested[0].begin();
+    std::sort(nested.begin(), nested.end());
+    EXPECT_EQ(nested[2].begin(), inner);
+    EXPECT_EQ(nested[0][0], 1);
+    EXPECT_EQ(nested[1][0], 2);
+
+    nested.reserve(100);
+    EXPECT_EQ(nested[2].begin(), inner);
+    nested.erase(0);
+    nested.pop_back();
+    EXPECT_EQ(nested.size(), 1);
+    nested.clear();
+    EXPECT_TRUE(nested.is_empty());
+}
+
+TEST(vectorTests, InsertOwnElement) {
+    my_vector<std::string> v{"a", "b", "c"};
+    v.reserve(10);
+    v.insert(v.begin(), v[2]);
+    EXPECT_EQ(v[0], "c");
+    EXPECT_EQ(v[3], "c");
+    v.shrink_to_fit();
+    v.insert(v.begin() + 1, v[0]);
+    EXPECT_EQ(v[1], "c");
+    EXPECT_EQ(v.size(), 5);
+}
+
+TEST(vectorTests, AssignCountValue) {
+    my_vector<int> v{1, 2, 3, 4, 5};
+    int* buffer = v.begin();
+    v.assign(3, 7);
+    EXPECT_EQ(v.begin(), buffer);
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(v.capacity(), 10);
+    for (size_t i = 0; i < v.size(); ++i) {
+        EXPECT_EQ(v[i], 7);
+    }
+    v.assign(20, 1);
+    EXPECT_EQ(v.size(), 20);
+    EXPECT_EQ(v.capacity(), 20);
+    EXPECT_EQ(v[19], 1);
+}
+
+TEST(vectorTests, AssignRange) {
+    my_vector<std::string> v{"a", "b", "c", "d"};
+    std::string* buffer = v.begin();
+    std::vector<std::string> source{"x", "y"};
+    v.assign(source.begin(), source.end());
+    EXPECT_EQ(v.begin(), buffer);
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v[0], "x");
+    EXPECT_EQ(v[1], "y");
+
+    my_vector<int> ints;
+    int raw[] = {4, 5, 6};
+    ints.assign(raw, raw + 3);
+    EXPECT_EQ(ints.size(), 3);
+    EXPECT_EQ(ints.capacity(), 3);
+    EXPECT_EQ(ints[2], 6);
+    ints.assign(my_span<const int>(raw).last(1));
+    EXPECT_EQ(ints.size(), 1);
+    EXPECT_EQ(ints[0], 6);
+}
+
+TEST(vectorTests, AssignInitializerList) {
+    my_vector<int> v;
+    v.assign({1, 2, 3});
+    my_vector<int> expected{1, 2, 3};
+    EXPECT_EQ(v, expected);
+    v.assign({});
+    EXPECT_TRUE(v.is_empty());
+    EXPECT_EQ(v.capacity(), 3);
+}
+
+TEST(vectorTests, AssignFromOwnElements) {
+    my_vector<int> v{1, 2, 3, 4};
+    v.assign(v.begin() + 1, v.end());
+    my_vector<int> expected{2, 3, 4};
+    EXPECT_EQ(v, expected);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);